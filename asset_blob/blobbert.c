@@ -1,74 +1,55 @@
+// blobbert.c
+// packs a directory of assets into one blob, see src/blob.h for the layout
+// ./blobbert assets_dir [out.blob [asset_ids.h]]
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <dirent.h>
 #include <sys/stat.h>
 
-#include "../rtypes.h"
-
-// 64 utf-8 seems reasonable, or ascii?
-//#define ASSET_NAME_MAX_LENGTH 64
-
-// just go 0 to 27
-typedef enum AssetType {
-    // image/texture
-    PNG, BMP, TGA, JPG, GIF,
-    QOI, PSD, DDS, HDR, KTX,
-    ASTC, PKM, PVR,
-    // fonts
-    FNT, TTF, OTF,
-    // models/meshes
-    OBJ, IQM, GLTF, VOX, M3D,
-    // audio
-    WAV, OGG, MP3, FLAC, XM, 
-    MOD, QOA
-} AssetType;
-
-
-typedef struct AssetHeader {
-    u32     magic;          // magic bytes for validity
-    u16     version;        // version of the format?
-    u16     count;          // number of assets
-    u32     toc_offset;     // where table of contents starts
-    u32     str_offset;     // where of string table starts
-    u32     data_offset;    // where data starts
-    u32     checksum;       // do we need this
-    // padding
-} AssetHeader;
-
-// header length = 0..toc_offset - 1
-// toc length = toc_offset..str_offset - 1
-// data length = str_offset..end of file? 
-
-typedef struct Toc {
-    u32         start;
-    u32         len;
-    u32         name_loc;
-    u8          type;
-    // padding
-    u8          _pad[3];
-} Toc;
-
-// hmm what is the correct approach to strings?
-// fixed size? simplifies things tbh
-// 
-typedef struct StringTable {
-    u16         len;
-    char        *path;
-} StringTable;
-
-
-// of course this is just how to hold it in memory while constructing it
-// the blob itself isn't made of pointers
-typedef struct AssetBlob {
-    AssetHeader     header;
-    Toc             *toc;
-    StringTable     *names;
-    // or list of 
-    // char *names[ASSET_NAME_MAX_LENGTH];
-    u8              *assets;
-} AssetBlob;
+#include "../src/rtypes.h"
+#include "../src/blob.h"
+
+#define BLOB_DEFAULT_OUT    "assets.blob"
+#define LZ_HASH_BITS        16
+#define LZ_MIN_MATCH        4
+#define LZ_MAX_OFFSET       65535
+#define LZ_LAST_LITERALS    5       // lz4 block rules, the tail is literals
+#define LZ_MATCH_LIMIT      12      // no match starts this close to the end
+
+// extension -> type, anything not in here goes in as ASSET_RAW
+static const struct {
+    const char *ext;
+    AssetType type;
+} EXTENSIONS[] = {
+    { "png",  ASSET_PNG },  { "bmp",  ASSET_BMP },  { "tga",  ASSET_TGA },
+    { "jpg",  ASSET_JPG },  { "jpeg", ASSET_JPG },  { "gif",  ASSET_GIF },
+    { "qoi",  ASSET_QOI },  { "psd",  ASSET_PSD },  { "dds",  ASSET_DDS },
+    { "hdr",  ASSET_HDR },  { "ktx",  ASSET_KTX },  { "astc", ASSET_ASTC },
+    { "pkm",  ASSET_PKM },  { "pvr",  ASSET_PVR },
+    { "fnt",  ASSET_FNT },  { "ttf",  ASSET_TTF },  { "otf",  ASSET_OTF },
+    { "obj",  ASSET_OBJ },  { "iqm",  ASSET_IQM },  { "gltf", ASSET_GLTF },
+    { "glb",  ASSET_GLTF }, { "vox",  ASSET_VOX },  { "m3d",  ASSET_M3D },
+    { "wav",  ASSET_WAV },  { "ogg",  ASSET_OGG },  { "mp3",  ASSET_MP3 },
+    { "flac", ASSET_FLAC }, { "xm",   ASSET_XM },   { "mod",  ASSET_MOD },
+    { "qoa",  ASSET_QOA },
+};
+
+static AssetType typeFromPath(const char *path) {
+    const char *dot = strrchr(path, '.');
+    const char *slash = strrchr(path, '/');
+    if (!dot || (slash && dot < slash)) return ASSET_RAW;
+    char ext[8];
+    size_t n = strlen(dot + 1);
+    if (n >= sizeof(ext)) return ASSET_RAW;
+    for (size_t i = 0; i <= n; i++)
+        ext[i] = (char)tolower((unsigned char)dot[1 + i]);
+    for (size_t i = 0; i < sizeof(EXTENSIONS) / sizeof(EXTENSIONS[0]); i++)
+        if (strcmp(ext, EXTENSIONS[i].ext) == 0) return EXTENSIONS[i].type;
+    return ASSET_RAW;
+}
 
 // directory ---------------------------------------------------------------- /
 typedef struct FileList {
@@ -126,61 +107,267 @@ void collectFiles(const char *path, FileList *list) {
     closedir(dr);
 }
 
-struct stat st;
+// readdir order is whatever the filesystem feels like, sort so the same
+// folder always packs to the same bytes
+static int comparePaths(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
 
-int main(int argc, char *argv[]) {
-    if (argc != 2) {
-        printf("Please enter a single directory path. ./cmd dir");
-        return 1;
+// reads a whole file into a fresh buffer, NULL on failure
+static u8 *readFile(const char *path, u32 *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (n < 0 || (unsigned long)n > UINT32_MAX) { fclose(f); return NULL; }
+    u8 *buf = malloc(n ? (size_t)n : 1);
+    if (buf && fread(buf, 1, (size_t)n, f) != (size_t)n) {
+        free(buf);
+        buf = NULL;
     }
+    fclose(f);
+    *len = (u32)n;
+    return buf;
+}
 
-    printf("Input directory is: %s\n", argv[1]);
-    
-    FileList files;
-    
-    initFileList(&files);
-    collectFiles(argv[1], &files);
+// compression -------------------------------------------------------------- /
+// plain lz4 block format, greedy with one hash probe per position. not the
+// best ratio, but any lz4 decoder reads it and the game's is a dozen lines
 
-    int all_string_length = 0;
-    int offset = 0;
-    char* all_string = NULL;
+// worst case for n incompressible bytes
+static u32 lzBound(u32 n) {
+    return n + n / 255 + 16;
+}
 
-    for (int i = 0; i < files.count; i++) {
-        char* input_path = files.paths[i];
-        int n = strlen(input_path) + 1;
+static u8 *lzLength(u8 *op, u32 n) {
+    for (; n >= 255; n -= 255) *op++ = 255;
+    *op++ = (u8)n;
+    return op;
+}
 
-        all_string_length += n;
-        all_string = realloc(all_string, all_string_length);
-        // should figure out diff between strncpy and memcpy
-        memcpy(all_string + offset, input_path, n);
-        offset += n;
-        //i want to copy the string into the big string
-        //basically a string blob, concantenated 
-        //each file path null terminated
-        printf("%s\n", input_path);
-       
+static u8 *lzSequence(u8 *op, const u8 *lit, u32 litLen, u32 offset,
+    u32 matchLen) {
+    u8 *token = op++;
+    *token = (u8)((litLen >= 15 ? 15 : litLen) << 4);
+    if (litLen >= 15) op = lzLength(op, litLen - 15);
+    memcpy(op, lit, litLen);
+    op += litLen;
+    if (!matchLen) return op;
+    *op++ = (u8)(offset & 0xff);
+    *op++ = (u8)(offset >> 8);
+    u32 ml = matchLen - LZ_MIN_MATCH;
+    *token |= (u8)(ml >= 15 ? 15 : ml);
+    if (ml >= 15) op = lzLength(op, ml - 15);
+    return op;
+}
 
-        stat(input_path, &st);
-        u64 file_size = st.st_size;
-        printf("%d\n", file_size);
-        printf("test\n");
+// returns the packed size, dst needs lzBound(n)
+static u32 lzCompress(const u8 *src, u32 n, u8 *dst) {
+    static u32 table[1 << LZ_HASH_BITS];    // position + 1, 0 = empty
+    memset(table, 0, sizeof(table));
+    u8 *op = dst;
+    u32 anchor = 0, i = 0;
+    u32 limit = n > LZ_MATCH_LIMIT ? n - LZ_MATCH_LIMIT : 0;
+    while (i < limit) {
+        u32 seq;
+        memcpy(&seq, src + i, 4);
+        u32 h = (seq * 2654435761u) >> (32 - LZ_HASH_BITS);
+        u32 ref = table[h];
+        table[h] = i + 1;
+        if (!ref || i - (ref - 1) > LZ_MAX_OFFSET
+            || memcmp(src + ref - 1, src + i, 4) != 0) {
+            i++;
+            continue;
+        }
+        ref--;
+        u32 m = LZ_MIN_MATCH;
+        while (i + m < n - LZ_LAST_LITERALS && src[ref + m] == src[i + m]) m++;
+        op = lzSequence(op, src + anchor, i - anchor, i - ref, m);
+        i += m;
+        anchor = i;
+    }
+    op = lzSequence(op, src + anchor, n - anchor, 0, 0);
+    return (u32)(op - dst);
+}
 
+// ids ---------------------------------------------------------------------- /
+// "inner/effect.jpg" -> ASSET_ID_INNER_EFFECT_JPG
+static void idFromName(const char *name, char *out, size_t cap) {
+    size_t n = (size_t)snprintf(out, cap, "ASSET_ID_");
+    for (; *name && n + 1 < cap; name++, n++)
+        out[n] = isalnum((unsigned char)*name)
+            ? (char)toupper((unsigned char)*name) : '_';
+    out[n] = '\0';
+}
 
-        //FILE* f = fopen(input_path, "r");
-        //printf("%s\n", f);
-        //fclose(f);
+// game code resolves assets through these, FindAssetHash(ASSET_ID_...)
+// is a probe or two into the blob's own table and never touches a string
+static int writeIds(const char *path, const char *blobName,
+    const char **names, int count) {
+    FILE *f = fopen(path, "w");
+    if (!f) return 0;
+    fprintf(f, "// asset_ids.h\n");
+    fprintf(f, "// generated by blobbert from the %s pack, don't edit\n",
+        blobName);
+    fprintf(f, "// BlobHashName of each path, see src/blob.h\n");
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "#define ASSET_ID_COUNT %d\n\n", count);
+    for (int i = 0; i < count; i++) {
+        char id[256];
+        idFromName(names[i], id, sizeof(id));
+        fprintf(f, "#define %-40s 0x%08xu  // %s\n",
+            id, BlobHashName(names[i]), names[i]);
     }
+    return fclose(f) == 0;
+}
 
-    printf("%d\n", all_string_length);
+// packing ------------------------------------------------------------------ /
+// of course the blob isn't made of pointers, it's laid out in one buffer:
+// sizes first, then offsets, then everything copied in place
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 4) {
+        printf("Please enter a directory path. "
+            "./cmd dir [out.blob [asset_ids.h]]\n");
+        return 1;
+    }
+    const char *out = (argc >= 3) ? argv[2] : BLOB_DEFAULT_OUT;
+    const char *idsOut = (argc == 4) ? argv[3] : NULL;
+    char root[1024];
+    snprintf(root, sizeof(root), "%s", argv[1]);
+    size_t rootLen = strlen(root);
+    while (rootLen > 1 && root[rootLen - 1] == '/') root[--rootLen] = '\0';
 
-    for (int i = 0; i < all_string_length; i++) {
-        if (all_string[i] == '\0')
-            printf("\\0");
-        else
-            printf("%c", all_string[i]);
+    FileList files;
+    initFileList(&files);
+    collectFiles(root, &files);
+    if (files.count > UINT16_MAX) {
+        printf("Too many files: %d, the format holds %d\n",
+            files.count, UINT16_MAX);
+        return 1;
+    }
+    qsort(files.paths, files.count, sizeof(char *), comparePaths);
+
+    int count = files.count;
+    Toc *toc = calloc(count ? count : 1, sizeof(Toc));
+    u8 **data = calloc(count ? count : 1, sizeof(u8 *));
+    const char **names = calloc(count ? count : 1, sizeof(char *));
+
+    // names are stored relative to the packed folder
+    u32 strLen = 0;
+    for (int i = 0; i < count; i++) {
+        const char *name = names[i] = files.paths[i] + rootLen + 1;
+        toc[i].name_loc = strLen;
+        toc[i].type = (u8)typeFromPath(name);
+        strLen += (u32)strlen(name) + 1;
+        data[i] = readFile(files.paths[i], &toc[i].raw_len);
+        if (!data[i]) {
+            printf("Could not read file: %s\n", files.paths[i]);
+            return 1;
+        }
+        // only keep the packed copy when it pays for the unpack at load,
+        // already compressed formats (jpg, ogg, ...) stay raw
+        toc[i].len = toc[i].raw_len;
+        u8 *packed = malloc(lzBound(toc[i].raw_len));
+        u32 n = lzCompress(data[i], toc[i].raw_len, packed);
+        if (n < toc[i].raw_len - toc[i].raw_len / 8) {
+            free(data[i]);
+            data[i] = packed;
+            toc[i].len = n;
+            toc[i].flags |= TOC_LZ4;
+        } else {
+            free(packed);
+        }
+    }
+
+    // the hash has to name one asset on its own, the game never compares
+    // strings, so two paths that collide (or map to the same id) stop the
+    // pack and one of them gets renamed
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            char a[256], b[256];
+            idFromName(names[i], a, sizeof(a));
+            idFromName(names[j], b, sizeof(b));
+            if (BlobHashName(names[i]) == BlobHashName(names[j])
+                || strcmp(a, b) == 0) {
+                printf("Name clash, rename one: %s %s\n", names[i], names[j]);
+                return 1;
+            }
+        }
+    }
+
+    // same probing the loader does, toc order in, so the table is stable
+    u32 slots = BlobHashSlots((u32)count);
+    HashSlot *table = calloc(slots, sizeof(HashSlot));
+    for (int i = 0; i < count; i++) {
+        u32 h = BlobHashName(names[i]);
+        u32 s = h & (slots - 1);
+        while (table[s].index) s = (s + 1) & (slots - 1);
+        table[s].hash = h;
+        table[s].index = (u16)(i + 1);
     }
-    printf("\n");
 
+    AssetHeader header = {
+        .magic   = BLOB_MAGIC,
+        .version = BLOB_VERSION,
+        .count   = (u16)count,
+    };
+    header.toc_offset  = BlobAlign(sizeof(AssetHeader));
+    header.hash_offset = header.toc_offset + (u32)(count * sizeof(Toc));
+    header.str_offset  = header.hash_offset + slots * (u32)sizeof(HashSlot);
+    header.data_offset = BlobAlign(header.str_offset + strLen);
+    u64 end = header.data_offset;
+    for (int i = 0; i < count; i++) {
+        toc[i].start = (u32)end;
+        end = BlobAlign((u32)end + toc[i].len);
+        if (end > UINT32_MAX) {
+            printf("Blob would pass 4 GiB at %s\n", files.paths[i]);
+            return 1;
+        }
+    }
+    header.size = (u32)end;
+
+    u8 *blob = calloc(1, header.size);
+    memcpy(blob + header.toc_offset, toc, count * sizeof(Toc));
+    memcpy(blob + header.hash_offset, table, slots * sizeof(HashSlot));
+    for (int i = 0; i < count; i++) {
+        memcpy(blob + header.str_offset + toc[i].name_loc,
+            names[i], strlen(names[i]) + 1);
+        memcpy(blob + toc[i].start, data[i], toc[i].len);
+    }
+    header.checksum = BlobChecksum(blob + header.toc_offset,
+        header.size - header.toc_offset);
+    memcpy(blob, &header, sizeof(header));
+
+    FILE *f = fopen(out, "wb");
+    if (!f || fwrite(blob, 1, header.size, f) != header.size) {
+        printf("Could not write blob: %s\n", out);
+        return 1;
+    }
+    fclose(f);
+    if (idsOut && !writeIds(idsOut, out, names, count)) {
+        printf("Could not write ids: %s\n", idsOut);
+        return 1;
+    }
+
+    u64 rawTotal = 0;
+    for (int i = 0; i < count; i++) {
+        printf("%4d  type %2u  @%8u  %8u  %8u %s  %08x  %s\n", i,
+            toc[i].type, toc[i].start, toc[i].len, toc[i].raw_len,
+            (toc[i].flags & TOC_LZ4) ? "lz4" : "raw",
+            BlobHashName(names[i]), names[i]);
+        rawTotal += toc[i].raw_len;
+    }
+    printf("%s: %d assets, %u hash slots, %u bytes (%llu unpacked), "
+        "checksum %08x\n", out, count, slots, header.size,
+        (unsigned long long)rawTotal, header.checksum);
+
+    for (int i = 0; i < count; i++) free(data[i]);
+    free(data);
+    free(names);
+    free(table);
+    free(toc);
+    free(blob);
     freeFileList(&files);
     return 0;
 }
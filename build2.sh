@@ -7,14 +7,23 @@ else
     PLATFORM_LIBS="-lGL -lm -lpthread -ldl -lrt -lX11"
 fi
 
-SRCS="src/main.c src/init.c src/spawn.c src/collision.c src/update.c src/draw.c"
+SRCS="src/main.c src/init.c src/pool.c src/spawn.c src/collision.c src/flow.c src/blob.c src/watch.c src/tuning.c src/snapshot.c src/input.c src/update.c src/lockstep.c src/draw.c"
 
 if [ "$1" = "n" ]; then
-    gcc $SRCS -o mecha -I src -I ./raylib/src -L ./lib -lraylib $PLATFORM_LIBS
+    # dev build, hot reloads asset_blob/assets into the running game
+    gcc $SRCS -o mecha -DASSET_HOT_RELOAD -I src -I ./raylib/src -L ./lib -lraylib $PLATFORM_LIBS
+elif [ "$1" = "blob" ]; then
+    # pack asset_blob/assets into one assets.blob, see src/blob.h
+    # and regenerate the ids the game looks assets up by
+    gcc asset_blob/blobbert.c -o blobbert -O2 -I src
+    ./blobbert asset_blob/assets assets.blob src/asset_ids.h
 elif [ "$1" = "o" ]; then
-    gcc $SRCS -o mecha -O2 -march=native -flto=auto -ffast-math -DNDEBUG -I src -I ./raylib/src -L ./lib -lraylib $PLATFORM_LIBS
+    gcc $SRCS -o mecha -O2 -march=native -fvect-cost-model=dynamic -flto=auto -ffast-math -DNDEBUG -DTUNING_CONST -I src -I ./raylib/src -L ./lib -lraylib $PLATFORM_LIBS
     strip mecha
 else
-    emcc $SRCS -o web_pkg/mecha.js -Os -I src -I ./raylib/src -L ./lib -l:libraylib.web.a -s USE_GLFW=3 -s SINGLE_FILE=1 -DPLATFORM_WEB
+    # the blob rides inside the single file build when there is one
+    EMBED=""
+    if [ -f assets.blob ]; then EMBED="--embed-file assets.blob"; fi
+    emcc $SRCS $EMBED -o web_pkg/mecha.js -Os -I src -I ./raylib/src -L ./lib -l:libraylib.web.a -s USE_GLFW=3 -s ALLOW_MEMORY_GROWTH=1 -s SINGLE_FILE=1 -DPLATFORM_WEB
     histos config.yaml -o mecha.html
 fi
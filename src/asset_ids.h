@@ -0,0 +1,9 @@
+// asset_ids.h
+// generated by blobbert from the assets.blob pack, don't edit
+// BlobHashName of each path, see src/blob.h
+#pragma once
+
+#define ASSET_ID_COUNT 2
+
+#define ASSET_ID_INNER_EFFECT_JPG                0x662e4750u  // inner/effect.jpg
+#define ASSET_ID_YODA_JPG                        0x72f528e3u  // yoda.jpg
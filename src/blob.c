@@ -0,0 +1,437 @@
+// blob.c
+// runtime side of the asset blob (format in blob.h, packed by blobbert)
+// the whole blob comes in with one mapping, raw assets are served straight
+// out of it through raylib's Load*FromMemory, lz4 ones are unpacked once at
+// load across a few threads
+#include "game.h"
+#include "blob.h"
+#include <stdlib.h>
+#include <stdatomic.h>
+#ifndef PLATFORM_WEB
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// raylib picks the decoder from the extension
+static const char *ASSET_EXT[ASSET_TYPE_COUNT] = {
+    [ASSET_PNG]  = ".png",  [ASSET_BMP]  = ".bmp",  [ASSET_TGA]  = ".tga",
+    [ASSET_JPG]  = ".jpg",  [ASSET_GIF]  = ".gif",  [ASSET_QOI]  = ".qoi",
+    [ASSET_PSD]  = ".psd",  [ASSET_DDS]  = ".dds",  [ASSET_HDR]  = ".hdr",
+    [ASSET_KTX]  = ".ktx",  [ASSET_ASTC] = ".astc", [ASSET_PKM]  = ".pkm",
+    [ASSET_PVR]  = ".pvr",  [ASSET_FNT]  = ".fnt",  [ASSET_TTF]  = ".ttf",
+    [ASSET_OTF]  = ".otf",  [ASSET_OBJ]  = ".obj",  [ASSET_IQM]  = ".iqm",
+    [ASSET_GLTF] = ".gltf", [ASSET_VOX]  = ".vox",  [ASSET_M3D]  = ".m3d",
+    [ASSET_WAV]  = ".wav",  [ASSET_OGG]  = ".ogg",  [ASSET_MP3]  = ".mp3",
+    [ASSET_FLAC] = ".flac", [ASSET_XM]   = ".xm",   [ASSET_MOD]  = ".mod",
+    [ASSET_QOA]  = ".qoa",  [ASSET_RAW]  = "",
+};
+
+static struct {
+    const u8 *base;
+    size_t size;
+    bool mapped;            // munmap on unload, otherwise it's a heap copy
+    const AssetHeader *header;
+    const Toc *toc;
+    const HashSlot *slots;  // the packer's table, used in place
+    const char *names;
+    u32 slotMask;
+    u8 *unpacked;           // every lz4 asset, back to back
+    const u8 **view;        // per toc entry, into the blob or unpacked
+    u8 **patch;             // hot reloaded bytes per entry, NULL until used
+    u32 *patchLen;
+} blob;
+
+// header, bounds of every toc entry and hash slot, names terminated inside
+// the table
+// the checksum reads every byte so it only runs in debug builds
+static bool ValidateBlob(void)
+{
+    const AssetHeader *h = (const AssetHeader *)blob.base;
+    if (blob.size < sizeof(AssetHeader)) return false;
+    if (h->magic != BLOB_MAGIC || h->version != BLOB_VERSION) return false;
+    if (h->size != blob.size) return false;
+    if (h->toc_offset > h->hash_offset || h->hash_offset > h->str_offset
+        || h->str_offset > h->data_offset || h->data_offset > h->size)
+        return false;
+    if ((size_t)h->count * sizeof(Toc) > h->hash_offset - h->toc_offset)
+        return false;
+    u32 slots = BlobHashSlots(h->count);
+    if ((size_t)slots * sizeof(HashSlot) > h->str_offset - h->hash_offset)
+        return false;
+    const HashSlot *table = (const HashSlot *)(blob.base + h->hash_offset);
+    u32 filled = 0;
+    for (u32 i = 0; i < slots; i++) {
+        if (table[i].index > h->count) return false;
+        filled += table[i].index != 0;
+    }
+    // a full table would never end a miss
+    if (filled != h->count) return false;
+    const Toc *toc = (const Toc *)(blob.base + h->toc_offset);
+    u32 strLen = h->data_offset - h->str_offset;
+    u64 unpacked = 0;
+    for (u32 i = 0; i < h->count; i++) {
+        if (toc[i].start < h->data_offset || toc[i].start > h->size
+            || toc[i].len > h->size - toc[i].start) return false;
+        if (toc[i].flags & TOC_LZ4) unpacked += toc[i].raw_len;
+        else if (toc[i].raw_len != toc[i].len) return false;
+        if (toc[i].name_loc >= strLen || toc[i].type >= ASSET_TYPE_COUNT)
+            return false;
+        const char *name = (const char *)blob.base + h->str_offset
+            + toc[i].name_loc;
+        if (!memchr(name, '\0', strLen - toc[i].name_loc)) return false;
+    }
+    if (unpacked > INT32_MAX) return false;
+#ifndef NDEBUG
+    if (BlobChecksum(blob.base + h->toc_offset, h->size - h->toc_offset)
+        != h->checksum) return false;
+#endif
+    return true;
+}
+
+// native maps the file read-only, web reads it once out of the embedded
+// file system (the blob rides inside the single file build)
+static bool MapBlob(const char *path)
+{
+#ifdef PLATFORM_WEB
+    int size = 0;
+    u8 *data = LoadFileData(path, &size);
+    if (!data) return false;
+    blob.base = data;
+    blob.size = (size_t)size;
+    blob.mapped = false;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return false;
+    blob.base = p;
+    blob.size = (size_t)st.st_size;
+    blob.mapped = true;
+#endif
+    return true;
+}
+
+// unpacking --------------------------------------------------------------- /
+
+// one lz4 block, every read and write bounds checked so a bad entry fails
+// instead of scribbling. false unless it fills dst exactly
+static bool Lz4Decode(const u8 *src, u32 srcLen, u8 *dst, u32 dstLen)
+{
+    const u8 *ip = src, *iend = src + srcLen;
+    u8 *op = dst, *oend = dst + dstLen;
+    while (ip < iend) {
+        u32 token = *ip++;
+        u32 lit = token >> 4;
+        if (lit == 15) {
+            u8 b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if (lit > (u32)(iend - ip) || lit > (u32)(oend - op)) return false;
+        memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip == iend) break;          // last sequence is literals only
+        if (iend - ip < 2) return false;
+        u32 offset = ip[0] | (u32)ip[1] << 8;
+        ip += 2;
+        if (!offset || offset > (u32)(op - dst)) return false;
+        u32 len = token & 15;
+        if (len == 15) {
+            u8 b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += 4;
+        if (len > (u32)(oend - op)) return false;
+        const u8 *match = op - offset;
+        if (offset >= len) {
+            memcpy(op, match, len);
+        } else {
+            // overlapping run, has to go forward a byte at a time
+            for (u32 k = 0; k < len; k++) op[k] = match[k];
+        }
+        op += len;
+    }
+    return op == oend;
+}
+
+// workers pull entries off a shared counter, biggest first so one large
+// asset doesn't start last and leave the rest of the pool idle
+static struct {
+    u16 *order;
+    u32 count;
+    atomic_uint next;
+    atomic_bool failed;
+} unpack;
+
+static void *UnpackWorker(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        u32 n = atomic_fetch_add(&unpack.next, 1);
+        if (n >= unpack.count) break;
+        const Toc *t = &blob.toc[unpack.order[n]];
+        if (!Lz4Decode(blob.base + t->start, t->len,
+                (u8 *)blob.view[unpack.order[n]], t->raw_len))
+            atomic_store(&unpack.failed, true);
+    }
+    return NULL;
+}
+
+static int CompareRawLen(const void *a, const void *b)
+{
+    u32 la = blob.toc[*(const u16 *)a].raw_len;
+    u32 lb = blob.toc[*(const u16 *)b].raw_len;
+    return (la < lb) - (la > lb);
+}
+
+// points every entry at its bytes, unpacking the lz4 ones, returns how many
+// threads it took (0 when nothing was packed, -1 on a bad entry)
+static int UnpackBlob(void)
+{
+    u32 count = blob.header->count;
+    blob.view = MemAlloc(count * sizeof(*blob.view));
+    unpack.order = MemAlloc(count * sizeof(u16));
+    unpack.count = 0;
+    u32 total = 0;
+    for (u32 i = 0; i < count; i++) {
+        if (blob.toc[i].flags & TOC_LZ4) {
+            unpack.order[unpack.count++] = (u16)i;
+            total += blob.toc[i].raw_len;
+        }
+    }
+    int threads = 0;
+    if (total) {
+        blob.unpacked = MemAlloc(total);
+        u32 at = 0;
+        for (u32 n = 0; n < unpack.count; n++) {
+            blob.view[unpack.order[n]] = blob.unpacked + at;
+            at += blob.toc[unpack.order[n]].raw_len;
+        }
+        qsort(unpack.order, unpack.count, sizeof(u16), CompareRawLen);
+        atomic_store(&unpack.next, 0);
+        atomic_store(&unpack.failed, false);
+        threads = 1;
+#ifndef PLATFORM_WEB
+        // the calling thread works too, so spawn one less
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (int)(cpus < 1 ? 1 : cpus);
+        if (threads > BLOB_UNPACK_THREADS) threads = BLOB_UNPACK_THREADS;
+        if (threads > (int)unpack.count) threads = (int)unpack.count;
+        pthread_t pool[BLOB_UNPACK_THREADS];
+        int spawned = 0;
+        for (; spawned < threads - 1; spawned++)
+            if (pthread_create(&pool[spawned], NULL, UnpackWorker, NULL))
+                break;
+        threads = spawned + 1;
+        UnpackWorker(NULL);
+        for (int t = 0; t < spawned; t++) pthread_join(pool[t], NULL);
+#else
+        UnpackWorker(NULL);
+#endif
+    }
+    for (u32 i = 0; i < count; i++)
+        if (!(blob.toc[i].flags & TOC_LZ4))
+            blob.view[i] = blob.base + blob.toc[i].start;
+    MemFree(unpack.order);
+    unpack.order = NULL;
+    return atomic_load(&unpack.failed) ? -1 : threads;
+}
+
+void UnloadAssetBlob(void)
+{
+    if (!blob.base) return;
+    // patches are counted by the header, which lives in the mapping
+    if (blob.patch) {
+        for (u32 i = 0; i < blob.header->count; i++)
+            UnloadFileData(blob.patch[i]);
+        MemFree(blob.patch);
+        MemFree(blob.patchLen);
+    }
+#ifndef PLATFORM_WEB
+    if (blob.mapped) munmap((void *)blob.base, blob.size);
+#endif
+    if (!blob.mapped) UnloadFileData((u8 *)blob.base);
+    MemFree(blob.unpacked);
+    MemFree(blob.view);
+    memset(&blob, 0, sizeof(blob));
+}
+
+// false when the file is missing or fails validation, the game runs fine
+// without it, every lookup just misses
+bool LoadAssetBlob(const char *path)
+{
+    UnloadAssetBlob();
+    double start = GetTime();
+    if (!MapBlob(path)) {
+        TraceLog(LOG_INFO, "BLOB: no asset blob at %s", path);
+        return false;
+    }
+    if (!ValidateBlob()) {
+        TraceLog(LOG_WARNING, "BLOB: %s is corrupt or from another version",
+            path);
+        UnloadAssetBlob();
+        return false;
+    }
+    blob.header = (const AssetHeader *)blob.base;
+    blob.toc = (const Toc *)(blob.base + blob.header->toc_offset);
+    blob.slots = (const HashSlot *)(blob.base + blob.header->hash_offset);
+    blob.names = (const char *)blob.base + blob.header->str_offset;
+    blob.slotMask = BlobHashSlots(blob.header->count) - 1;
+    int threads = UnpackBlob();
+    if (threads < 0) {
+        TraceLog(LOG_WARNING, "BLOB: %s has a bad lz4 entry", path);
+        UnloadAssetBlob();
+        return false;
+    }
+    // throughput counts what the game ends up with, unpacked bytes
+    double ms = (GetTime() - start) * 1000.0;
+    u64 bytes = 0;
+    for (u32 i = 0; i < blob.header->count; i++) bytes += blob.toc[i].raw_len;
+    TraceLog(LOG_INFO, "BLOB: %s, %u assets, %zu -> %llu bytes in %.2f ms "
+        "(%.0f MiB/s, %d unpack threads)", path, blob.header->count,
+        blob.size, (unsigned long long)bytes, ms,
+        ms > 0.0 ? bytes / (ms * 1048.576) : 0.0, threads);
+    return true;
+}
+
+// lookups ------------------------------------------------------------------ /
+
+// toc index for an id from asset_ids.h (or any BlobHashName), -1 when it's
+// not in the blob. hashes are unique per blob, so no string compare
+int FindAssetHash(u32 hash)
+{
+    if (!blob.header) return -1;
+    for (u32 s = hash & blob.slotMask; blob.slots[s].index;
+         s = (s + 1) & blob.slotMask)
+        if (blob.slots[s].hash == hash) return blob.slots[s].index - 1;
+    return -1;
+}
+
+// by path relative to the packed folder, e.g. "inner/effect.jpg", for tools
+// and debug, game code uses the ids. a path that isn't packed can still
+// share a hash with one that is, so this one checks the name
+int FindAsset(const char *name)
+{
+    int i = FindAssetHash(BlobHashName(name));
+    if (i < 0 || strcmp(blob.names + blob.toc[i].name_loc, name) != 0)
+        return -1;
+    return i;
+}
+
+// bytes of an asset inside the blob, valid until UnloadAssetBlob
+const u8 *AssetData(int idx, int *len)
+{
+    if (!blob.header || idx < 0 || idx >= blob.header->count) {
+        if (len) *len = 0;
+        return NULL;
+    }
+    if (blob.patch && blob.patch[idx]) {
+        if (len) *len = (int)blob.patchLen[idx];
+        return blob.patch[idx];
+    }
+    if (len) *len = (int)blob.toc[idx].raw_len;
+    return blob.view[idx];
+}
+
+// hot reload (watch.c) swaps an entry's bytes for a fresh copy of the file.
+// data comes from LoadFileData and belongs to the blob after this. the
+// mapping stays read-only, only the entry's view moves, so a repack is
+// still what makes the change stick. the previous patch is freed, so a
+// music stream opened on it needs reloading too
+void PatchAsset(int idx, u8 *data, int len)
+{
+    if (!blob.header || idx < 0 || idx >= blob.header->count) {
+        UnloadFileData(data);
+        return;
+    }
+    if (!blob.patch) {
+        blob.patch = MemAlloc(blob.header->count * sizeof(*blob.patch));
+        blob.patchLen = MemAlloc(blob.header->count * sizeof(u32));
+    }
+    UnloadFileData(blob.patch[idx]);
+    blob.patch[idx] = data;
+    blob.patchLen[idx] = (u32)len;
+}
+
+const char *AssetName(int idx)
+{
+    if (!blob.header || idx < 0 || idx >= blob.header->count) return NULL;
+    return blob.names + blob.toc[idx].name_loc;
+}
+
+// raylib loaders ----------------------------------------------------------- /
+// take ids from asset_ids.h, e.g. LoadAssetTexture(ASSET_ID_YODA_JPG)
+// decoded results (pixels, glyphs, samples) are raylib's own allocations,
+// the file bytes are read in place
+
+static const char *AssetExt(int idx)
+{
+    return ASSET_EXT[blob.toc[idx].type];
+}
+
+Texture2D LoadAssetTexture(u32 id)
+{
+    Texture2D tex = { 0 };
+    int len, i = FindAssetHash(id);
+    const u8 *data = AssetData(i, &len);
+    if (!data) {
+        TraceLog(LOG_WARNING, "BLOB: texture %08x not found", id);
+        return tex;
+    }
+    Image img = LoadImageFromMemory(AssetExt(i), data, len);
+    tex = LoadTextureFromImage(img);
+    UnloadImage(img);
+    return tex;
+}
+
+Font LoadAssetFont(u32 id, int fontSize)
+{
+    int len, i = FindAssetHash(id);
+    const u8 *data = AssetData(i, &len);
+    if (!data) {
+        TraceLog(LOG_WARNING, "BLOB: font %08x not found", id);
+        return GetFontDefault();
+    }
+    return LoadFontFromMemory(AssetExt(i), data, len, fontSize, NULL, 0);
+}
+
+Wave LoadAssetWave(u32 id)
+{
+    int len, i = FindAssetHash(id);
+    const u8 *data = AssetData(i, &len);
+    if (!data) {
+        TraceLog(LOG_WARNING, "BLOB: wave %08x not found", id);
+        return (Wave){ 0 };
+    }
+    return LoadWaveFromMemory(AssetExt(i), data, len);
+}
+
+// streams decode from the blob as they play, so the blob has to outlive
+// the music, which it does unless someone unloads it mid run
+Music LoadAssetMusic(u32 id)
+{
+    int len, i = FindAssetHash(id);
+    const u8 *data = AssetData(i, &len);
+    if (!data) {
+        TraceLog(LOG_WARNING, "BLOB: music %08x not found", id);
+        return (Music){ 0 };
+    }
+    return LoadMusicStreamFromMemory(AssetExt(i), data, len);
+}
@@ -0,0 +1,116 @@
+// blob.h
+// the packed asset blob format, shared by the packer (asset_blob/blobbert.c)
+// and the game side loader. one file, no pointers, every offset counts from
+// the start of the blob so it can be used straight out of a mapping
+//
+// [AssetHeader][Toc x count][HashSlot x slots][string table][pad][data]
+//
+// little endian only, which is everything we ship to (x86, arm, wasm)
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rtypes.h"
+
+#define BLOB_MAGIC      0x424f4c42u     // "BLOB" in the first four bytes
+#define BLOB_VERSION    3
+#define BLOB_ALIGN      16              // toc, strings and every asset start
+
+// just go 0 to 28
+typedef enum AssetType {
+    // image/texture
+    ASSET_PNG, ASSET_BMP, ASSET_TGA, ASSET_JPG, ASSET_GIF,
+    ASSET_QOI, ASSET_PSD, ASSET_DDS, ASSET_HDR, ASSET_KTX,
+    ASSET_ASTC, ASSET_PKM, ASSET_PVR,
+    // fonts
+    ASSET_FNT, ASSET_TTF, ASSET_OTF,
+    // models/meshes
+    ASSET_OBJ, ASSET_IQM, ASSET_GLTF, ASSET_VOX, ASSET_M3D,
+    // audio
+    ASSET_WAV, ASSET_OGG, ASSET_MP3, ASSET_FLAC, ASSET_XM,
+    ASSET_MOD, ASSET_QOA,
+    // anything else, served as plain bytes
+    ASSET_RAW,
+    ASSET_TYPE_COUNT
+} AssetType;
+
+typedef struct AssetHeader {
+    u32     magic;          // BLOB_MAGIC
+    u16     version;        // BLOB_VERSION, bump on any layout change
+    u16     count;          // number of assets
+    u32     toc_offset;     // where table of contents starts
+    u32     str_offset;     // where the string table starts
+    u32     data_offset;    // where data starts
+    u32     checksum;       // BlobChecksum of [toc_offset, size)
+    u32     size;           // whole blob in bytes, catches truncated files
+    u32     hash_offset;    // where the name hash table starts
+} AssetHeader;
+
+// Toc.flags
+#define TOC_LZ4         0x01            // data is one lz4 block, see blob.c
+
+// toc entries are sorted by name, the packer keeps the order stable so the
+// same asset folder always packs to the same bytes
+typedef struct Toc {
+    u32         start;      // offset of the data from the start of the blob
+    u32         len;        // bytes in the blob
+    u32         raw_len;    // bytes once unpacked, same as len when stored raw
+    u32         name_loc;   // offset into the string table
+    u8          type;       // AssetType
+    u8          flags;      // TOC_*
+    // padding
+    u8          _pad[2];
+} Toc;
+
+// open addressing table of name hash -> toc index, written by the packer so
+// the game never builds or compares anything. BlobHashSlots(count) slots,
+// linear probing from hash & (slots - 1), index 0 marks an empty slot.
+// the packer refuses two names with the same hash, so a hash on its own
+// names exactly one asset and the ids in asset_ids.h can stand in for paths
+typedef struct HashSlot {
+    u32         hash;       // BlobHashName of the path
+    u16         index;      // toc index + 1, 0 = empty
+    u16         _pad;
+} HashSlot;
+
+// strings are concatenated, null terminated, paths relative to the packed
+// folder with '/' separators, e.g. "inner/effect.jpg"
+
+_Static_assert(sizeof(AssetHeader) == 32, "blob header layout changed");
+_Static_assert(sizeof(Toc) == 20, "blob toc layout changed");
+_Static_assert(sizeof(HashSlot) == 8, "blob hash slot layout changed");
+
+// fnv-1a, plenty for catching a bad copy, not a security thing
+static inline u32 BlobChecksum(const u8 *p, size_t n)
+{
+    u32 h = 2166136261u;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// name hash for lookups, same fnv-1a over the path without the terminator
+static inline u32 BlobHashName(const char *name)
+{
+    u32 h = 2166136261u;
+    for (; *name; name++) {
+        h ^= (u8)*name;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// power of two, at least twice the count so probes stay short
+static inline u32 BlobHashSlots(u32 count)
+{
+    u32 slots = 16;
+    while (slots < 2 * count) slots <<= 1;
+    return slots;
+}
+
+static inline u32 BlobAlign(u32 n)
+{
+    return (n + BLOB_ALIGN - 1) & ~(u32)(BLOB_ALIGN - 1);
+}
@@ -25,9 +25,9 @@ static bool LineSegCircle(
 // Line segment vs OBB: transform to local space, then slab test
 static bool LineSegOBB(
     Vector2 la, Vector2 lb,
-    Vector2 center, float hw, float hh, float angle)
+    Vector2 center, float hw, float hh, Vector2 axis)
 {
-    float ca = cosf(angle), sa = sinf(angle);
+    float ca = axis.x, sa = axis.y;
     Vector2 da = Vector2Subtract(la, center);
     Vector2 db = Vector2Subtract(lb, center);
     // rotate into OBB local space
@@ -61,18 +61,30 @@ static bool LineSegOBB(
 // OBB collision helpers (for RECT enemy hitbox)
 // Get the enemy facing angle (faces aggro target or player shadow)
 float EnemyAngle(Enemy *e) {
-    Vector2 target = (e->aggroIdx >= 0)
-        ? g.deployables[e->aggroIdx].pos : g.player.shadowPos;
+    Deployable *ad = GetDeployable(e->aggro);
+    Vector2 target = ad ? ad->pos : g.player.shadowPos;
     Vector2 toTarget = Vector2Subtract(target, e->pos);
     return atan2f(toTarget.y, toTarget.x);
 }
 
+// same facing as a unit vector, which is what the hit tests want, cos/sin of
+// the atan2 is just the normalized direction. sitting right on the target
+// reads as angle 0 like atan2f(0, 0) does
+static Vector2 EnemyAxis(Enemy *e) {
+    Deployable *ad = GetDeployable(e->aggro);
+    Vector2 target = ad ? ad->pos : g.player.shadowPos;
+    Vector2 toTarget = Vector2Subtract(target, e->pos);
+    float len = sqrtf(toTarget.x * toTarget.x + toTarget.y * toTarget.y);
+    if (len <= 0.0f) return (Vector2){ 1, 0 };
+    return (Vector2){ toTarget.x / len, toTarget.y / len };
+}
+
 // Check if a point is inside an oriented bounding box
 static bool PointInOBB(
     Vector2 point, Vector2 center,
-    float hw, float hh, float angle)
+    float hw, float hh, Vector2 axis)
 {
-    float ca = cosf(angle), sa = sinf(angle);
+    float ca = axis.x, sa = axis.y;
     Vector2 d = Vector2Subtract(point, center);
     float localX =  d.x * ca + d.y * sa;
     float localY = -d.x * sa + d.y * ca;
@@ -83,9 +95,9 @@ static bool PointInOBB(
 // refactor this signature to each same type on same line
 static bool CircleOBBOverlap(
     Vector2 circlePos, float radius,
-    Vector2 center, float hw, float hh, float angle)
+    Vector2 center, float hw, float hh, Vector2 axis)
 {
-    float ca = cosf(angle), sa = sinf(angle);
+    float ca = axis.x, sa = axis.y;
     Vector2 d = Vector2Subtract(circlePos, center);
     float localX =  d.x * ca + d.y * sa;
     float localY = -d.x * sa + d.y * ca;
@@ -96,6 +108,42 @@ static bool CircleOBBOverlap(
     return (dx * dx + dy * dy) <= radius * radius;
 }
 
+// arc sectors -------------------------------------------------------------- /
+// shield, slam, lunge and the CIRC sweep all ask "is this thing in my
+// cone". the trig happens once when the sector is built, per target it's a
+// dot product against cos(half arc)
+
+ArcSector MakeArc(Vector2 origin, float angle, float halfArc, float radius)
+{
+    ArcSector arc = { origin, { cosf(angle), sinf(angle) }, -1.0f, radius };
+    if (halfArc < PI) arc.cosHalf = cosf(halfArc);
+    return arc;
+}
+
+// the wedge swept from one angle to another (from <= to), for swings
+ArcSector MakeArcBetween(Vector2 origin, float from, float to, float radius)
+{
+    return MakeArc(origin, (from + to) * 0.5f, (to - from) * 0.5f, radius);
+}
+
+// within radius + pad and inside the cone. the angle is checked on the point
+// itself, pad only grows the reach (enemy size)
+bool InArc(const ArcSector *arc, Vector2 point, float pad)
+{
+    float dx = point.x - arc->origin.x;
+    float dy = point.y - arc->origin.y;
+    float d2 = dx * dx + dy * dy;
+    float r = arc->radius + pad;
+    if (d2 > r * r) return false;
+    // dot / |d| >= cosHalf, squared so there's no sqrt either. past 90
+    // degrees cosHalf goes negative and the comparison flips
+    float dot = dx * arc->facing.x + dy * arc->facing.y;
+    float c2d2 = arc->cosHalf * arc->cosHalf * d2;
+    if (arc->cosHalf >= 0.0f)
+        return dot >= 0.0f && dot * dot >= c2d2;
+    return dot >= 0.0f || dot * dot <= c2d2;
+}
+
 // Collision Dispatchers — switch on enemy type, one case per shaPe
 // Sweep line (sword, spin): does segment AB intersect enemy hitbox?
 // this does all the hitscan damage detection too because it makes contact
@@ -104,7 +152,7 @@ bool EnemyHitSweep(Enemy *e, Vector2 a, Vector2 b, float pad) {
     case RECT:
         return LineSegOBB(a, b, e->pos,
             e->size + pad, e->size * RECT_ASPECT_RATIO + pad,
-            EnemyAngle(e));
+            EnemyAxis(e));
     default:
         return LineSegCircle(a, b, e->pos, e->size + pad);
     }
@@ -116,7 +164,7 @@ bool EnemyHitPoint(Enemy *e, Vector2 point, float pad) {
     case RECT:
         return PointInOBB(point, e->pos,
             e->size + pad, e->size * RECT_ASPECT_RATIO + pad,
-            EnemyAngle(e));
+            EnemyAxis(e));
     default:
         return Vector2Distance(point, e->pos) <= e->size + pad;
     }
@@ -127,8 +175,172 @@ bool EnemyHitCircle(Enemy *e, Vector2 center, float radius) {
     switch (e->type) {
     case RECT:
         return CircleOBBOverlap(center, radius, e->pos,
-            e->size, e->size * RECT_ASPECT_RATIO, EnemyAngle(e));
+            e->size, e->size * RECT_ASPECT_RATIO, EnemyAxis(e));
     default:
         return Vector2Distance(center, e->pos) <= radius + e->size;
     }
 }
+
+// Enemy broadphase --------------------------------------------------------- /
+// uniform grid over the combat zone, rebuilt with a counting sort whenever
+// enemies move. cells are numbered in Morton (Z) order, so the item list is
+// the enemies sorted by Z-order and doubles as the spatial sort permutation
+#define GRID_CELLS (ENEMY_GRID_DIM * ENEMY_GRID_DIM)
+
+static struct {
+    int cellStart[GRID_CELLS + 1];
+    int items[MAX_ENEMIES];
+    int count;
+    float reach;        // largest enemy hitbox radius, pads every query
+} grid;
+
+// spread the low 16 bits out to the even bit positions
+static u32 Part1By1(u32 x)
+{
+    x &= 0x0000ffff;
+    x = (x | (x << 8)) & 0x00ff00ff;
+    x = (x | (x << 4)) & 0x0f0f0f0f;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+    return x;
+}
+
+static int GridCoord(float v)
+{
+    int c = (int)(v / ENEMY_GRID_CELL);
+    if (c < 0) return 0;
+    if (c >= ENEMY_GRID_DIM) return ENEMY_GRID_DIM - 1;
+    return c;
+}
+
+// positions outside the combat zone clamp into the border cells
+static u32 GridCell(Vector2 pos)
+{
+    return Part1By1((u32)GridCoord(pos.x - MAP_LEFT))
+        | (Part1By1((u32)GridCoord(pos.y)) << 1);
+}
+
+// bounding radius of the hitbox, RECT is an OBB
+static float EnemyReach(const Enemy *e)
+{
+    if (e->type == RECT)
+        return e->size * sqrtf(1.0f + RECT_ASPECT_RATIO * RECT_ASPECT_RATIO);
+    return e->size;
+}
+
+void BuildEnemyGrid(void)
+{
+    static u32 cellOf[MAX_ENEMIES];
+    int n = g.pool[POOL_ENEMY].count;
+    memset(grid.cellStart, 0, sizeof(grid.cellStart));
+    grid.reach = 0;
+    for (int i = 0; i < n; i++) {
+        Enemy *e = &g.enemies[i];
+        if (!e->active) continue;
+        cellOf[i] = GridCell(e->pos);
+        grid.cellStart[cellOf[i] + 1]++;
+        float r = EnemyReach(e);
+        if (r > grid.reach) grid.reach = r;
+    }
+    for (int c = 0; c < GRID_CELLS; c++)
+        grid.cellStart[c + 1] += grid.cellStart[c];
+    grid.count = grid.cellStart[GRID_CELLS];
+    // scatter in slot order, cellStart[c] ends up at the end of cell c
+    for (int i = 0; i < n; i++) {
+        if (!g.enemies[i].active) continue;
+        grid.items[grid.cellStart[cellOf[i]]++] = i;
+    }
+    // shift back so cellStart[c] is the start again
+    for (int c = GRID_CELLS; c > 0; c--)
+        grid.cellStart[c] = grid.cellStart[c - 1];
+    grid.cellStart[0] = 0;
+}
+
+// re-sort g.enemies by Z-order so neighbours in the world are neighbours in
+// memory, the grid walk then streams through contiguous slots
+// only at tick boundaries, it moves enemies (see ReorderEnemies)
+void SortEnemiesSpatial(void)
+{
+    BuildEnemyGrid();
+    ReorderEnemies(grid.items, grid.count);
+    for (int k = 0; k < grid.count; k++)
+        grid.items[k] = k;
+}
+
+// candidate enemies whose hitbox may touch the circle, exact test is up to
+// the caller. slots can be inactive if something died since the build
+int QueryEnemies(Vector2 center, float radius, int *out, int maxOut)
+{
+    float pad = radius + grid.reach;
+    int x0 = GridCoord(center.x - pad - MAP_LEFT);
+    int x1 = GridCoord(center.x + pad - MAP_LEFT);
+    int y0 = GridCoord(center.y - pad);
+    int y1 = GridCoord(center.y + pad);
+    int n = 0;
+    for (int cy = y0; cy <= y1; cy++) {
+        u32 row = Part1By1((u32)cy) << 1;
+        for (int cx = x0; cx <= x1; cx++) {
+            u32 c = row | Part1By1((u32)cx);
+            for (int k = grid.cellStart[c];
+                 k < grid.cellStart[c + 1] && n < maxOut; k++)
+                out[n++] = grid.items[k];
+        }
+    }
+    return n;
+}
+
+// Enemy separation --------------------------------------------------------- /
+// pairwise circle push-out over grid neighbours, displacements are summed
+// first and applied after (Jacobi) so slot order doesn't bias the result
+// the heavier side of a pair moves less, rooted/stunned enemies are anchors
+static float SeparationMass(const Enemy *e)
+{
+    if (e->rootTimer > 0 || e->stunTimer > 0) return ENEMY_ROOTED_MASS;
+    return ENEMY_DEFS[e->type].mass;
+}
+
+void SeparateEnemies(void)
+{
+    static Vector2 push[MAX_ENEMIES];
+    static int cand[MAX_ENEMIES];
+    int n = g.pool[POOL_ENEMY].count;
+    memset(push, 0, (size_t)n * sizeof(Vector2));
+
+    bool moved = false;
+    for (int i = 0; i < n; i++) {
+        Enemy *a = &g.enemies[i];
+        if (!a->active) continue;
+        float ma = SeparationMass(a);
+        int m = QueryEnemies(a->pos, a->size, cand, MAX_ENEMIES);
+        for (int c = 0; c < m; c++) {
+            int j = cand[c];
+            if (j <= i) continue;       // each pair once
+            Enemy *b = &g.enemies[j];
+            if (!b->active) continue;
+            Vector2 d = Vector2Subtract(b->pos, a->pos);
+            float minDist = a->size + b->size;
+            float dist2 = d.x * d.x + d.y * d.y;
+            if (dist2 >= minDist * minDist) continue;
+            float dist = sqrtf(dist2);
+            // exactly stacked (same spawn point), split along a fixed axis
+            Vector2 nrm = (dist > 1e-4f)
+                ? Vector2Scale(d, 1.0f / dist) : (Vector2){ 1.0f, 0.0f };
+            float mb = SeparationMass(b);
+            float overlap = (minDist - dist) * TUNE(ENEMY_SEPARATION);
+            float wa = mb / (ma + mb);
+            push[i] = Vector2Subtract(push[i], Vector2Scale(nrm, overlap * wa));
+            push[j] = Vector2Add(push[j], Vector2Scale(nrm, overlap * (1.0f - wa)));
+            moved = true;
+        }
+    }
+    if (!moved) return;
+
+    for (int i = 0; i < n; i++) {
+        Enemy *e = &g.enemies[i];
+        if (!e->active) continue;
+        e->pos = Vector2Clamp(Vector2Add(e->pos, push[i]),
+            (Vector2){ MAP_LEFT, 0 }, (Vector2){ MAP_RIGHT, MAP_SIZE });
+    }
+    // positions changed, keep the grid exact for the rest of the tick
+    BuildEnemyGrid();
+}
@@ -1,5 +1,7 @@
 // default.h
 // game configuration constants, tweak these to tune gameplay
+// the balance numbers (speeds, cooldowns, damage, radii) moved to
+// tuning_table.h so they can load at runtime, read them with TUNE(NAME)
 #pragma once
 
 // Window
@@ -28,12 +30,50 @@
 #define NUM_PRIMARY_WEAPONS     5
 
 // Entity Pools
-#define MAX_PROJECTILES         1024
-#define MAX_ENEMIES             1024
-#define MAX_PARTICLES           1024
+// MAX_* are compile-time ceilings: the arena reserves this many slots and the
+// side tables (hit bitsets, chain flags) are sized by them
+// runtime capacity starts at POOL_*_INIT and doubles up to the max
+// override per run with --pool-<name>=<init>[:<max>]
+#define MAX_PLAYER_SHOTS        4096
+#define MAX_ENEMY_SHOTS         8192
+#define MAX_ENEMIES             8192
+#define MAX_PARTICLES           65536
 #define MAX_BEAMS               8
 #define MAX_DEPLOYABLES         1024
 #define MAX_VFX_TIMERS          72      // this could be more?
+#define POOL_PLAYER_SHOT_INIT   512
+#define POOL_ENEMY_SHOT_INIT    1024
+#define POOL_ENEMY_INIT         1024
+#define POOL_PARTICLE_INIT      1024
+#define POOL_DEPLOYABLE_INIT    256
+#define POOL_ARENA_ALIGN        64      // cache line per pool region
+#define POOL_COMPACT            true    // keep live enemies/shots dense, --no-compact
+#define PATTERN_MAX_SHOTS       32      // bullets in one EmitPattern (count * rows)
+// Snapshots — whole state copies for quick save, repro and rollback
+// each slot is sized for every pool at max, pages only commit once written
+#define SNAPSHOT_RING           8
+#define SNAPSHOT_DELTA_SMOOTH   0.05f   // ema weight for the F3 bytes/tick
+#define SNAPSHOT_DELTA_LOG      600     // ticks between delta size logs
+// Sim step — input frame in, next state out, same frames same ticks
+#define SIM_RNG_SEED            0x2545f491u // when nobody seeded g.rng
+#define STEP_TIME_SMOOTH        0.05f   // ema weight for the F3 step timing
+#define LOCKSTEP_TICKS          3600    // --lockstep default
+
+// Assets
+// one packed blob (./build2.sh blob), mapped at startup, optional
+#define ASSET_BLOB_PATH         "assets.blob"
+#define BLOB_UNPACK_THREADS     8       // cap, native only, web unpacks inline
+// runtime tuning (tuning_table.h), a loose file beats the blob's copy
+#define TUNING_PATH             "tuning.bin"
+#define TUNING_BLOB_NAME        "tuning.bin"
+#define TUNING_TEXT_PATH        "tuning.txt"    // watched, goes over the .bin
+#define TUNING_POLL_INTERVAL    0.25            // s between tuning.txt reads
+// hot reload, native dev build only (./build2.sh n sets ASSET_HOT_RELOAD)
+#define ASSET_WATCH_DIR         "asset_blob/assets"
+#define WATCH_MAX_DIRS          64
+#define WATCH_MAX_TEXTURES      64
+#define WATCH_MAX_BATCH         32      // distinct files reloaded per poll
+#define WATCH_PATH_MAX          512
 
 // Map
 #define MAP_SIZE                2000.0f
@@ -64,11 +104,15 @@
 
 // Physics ------------------------------------------------------------------ /
 #define DT_MAX                  0.05f
-#define CAMERA_LERP_RATE        8.0f
 #define PARTICLE_DRAG           3.0f
-#define ENEMY_VEL_LERP_RATE     3.0f
-#define ENEMY_CONTACT_KNOCKBACK 200.0f
-#define SPAWN_INITIAL_DELAY     1.0f
+// Enemy broadphase — uniform grid over the combat zone, cells in Morton order
+#define ENEMY_GRID_DIM          32      // cells per axis, power of two
+#define ENEMY_GRID_CELL         (MAP_SIZE / ENEMY_GRID_DIM)
+#define ENEMY_SORT_INTERVAL     16      // ticks between Z-order re-sorts
+#define ENEMY_ROOTED_MASS       1000.0f // rooted/stunned enemies don't get shoved
+// Flow field — shared chase direction toward the player shadow
+#define FLOW_CELL               50.0f
+#define FLOW_DIRECT_DIST        (FLOW_CELL * 2.0f)  // closer than this, steer straight
 
 // Weapon Swap
 #define WEAPON_SWAP_KEY         KEY_LEFT_CONTROL
@@ -77,41 +121,17 @@
 // Player
 #define PLAYER_SPAWN_X          BASE_CENTER_X
 #define PLAYER_SPAWN_Y          (BASE_CENTER_Y - 180.0f)
-#define PLAYER_SPEED            300.0f
 #define PLAYER_SIZE             16.0f
-#define PLAYER_HP               100
-#define IFRAME_DURATION         0.9f
-#define PLAYER_ROT_SPEED        1.0f
 #define PLAYER_ROT_TILT         0.45f
 #define PLAYER_BLINK_RATE       20
 #define MUZZLE_OFFSET           4.0f
 
 // Gun
-#define GUN_FIRE_RATE           12.0f
-#define GUN_BULLET_SPEED        1200.0f
-#define GUN_BULLET_LIFETIME     2.0f
-#define GUN_BULLET_DAMAGE       10
-#define GUN_PROJECTILE_SIZE     3.0f
-#define GUN_SPREAD              30
 #define GUN_TIP_OFFSET          12.0f
 #define GUN_BARREL_THICKNESS    3.0f
 
-// Overheat (shared M1/M2 heat resource)
-#define GUN_HEAT_PER_SHOT        0.02f    // M1
-#define MINIGUN_HEAT_PER_SHOT    0.004f   // M2
-#define GUN_HEAT_DECAY           0.3f     // passive heat loss per second
-#define GUN_HEAT_DECAY_DELAY     0.4f     // seconds after last shot before heat decays
-#define GUN_OVERHEAT_DECAY       0.5f     // heat loss/sec while overheated (normal/miss)
-#define GUN_OVERHEAT_THRESHOLD   1.0f     // heat level that triggers overheat
-#define GUN_OVERHEAT_CLEAR       0.0f     // heat must reach this to unlock
 // QTE vent
-#define GUN_VENT_CURSOR_SPEED    1.0f     // cursor sweeps 0->1 in 1/speed seconds
 #define GUN_VENT_ZONE_WIDTH      0.12f    // sweet spot width (fraction of bar)
-#define GUN_VENT_ZONE_MIN        0.6f     // earliest sweet spot left edge
-#define GUN_VENT_ZONE_MAX        0.78f    // latest sweet spot left edge (max + width <= 1)
-#define GUN_VENT_HIT_DECAY       5.0f     // heat loss/sec on perfect vent
-#define GUN_OVERHEAT_DASH_BOOST  1.4f     // movespeed multiplier after dash during overheat
-#define GUN_OVERHEAT_BOOST_DUR   3.0f     // seconds the dash-vent movespeed buff lasts
 #define GUN_OVERHEAT_TRAIL_SPEED 20.0f
 #define GUN_OVERHEAT_TRAIL_COLOR (Color){ 100, 200, 255, 150 }
 #define GUN_OVERHEAT_TRAIL_SIZE  2.0f
@@ -128,18 +148,6 @@
 #define GUN_VENT_FAIL_COLOR      (Color){ 80, 20, 20, 255 }
 
 // Minigun
-#define MINIGUN_MAX_FIRE_RATE    40.0f
-#define MINIGUN_MIN_FIRE_RATE    4.0f
-#define MINIGUN_SPIN_UP_TIME     0.8f
-#define MINIGUN_SPIN_DOWN_TIME   1.6f
-#define MINIGUN_BULLET_SPEED     1000.0f
-#define MINIGUN_BULLET_LIFETIME  1.5f
-#define MINIGUN_BULLET_DAMAGE    6
-#define MINIGUN_PROJECTILE_SIZE  2.5f
-#define MINIGUN_SPREAD_MIN       20
-#define MINIGUN_SPREAD_MAX       80
-#define MINIGUN_SLOW_FACTOR      0.25f
-#define MINIGUN_SLOW_LINGER      0.25f
 #define MINIGUN_TIP_OFFSET       14.0f
 #define MINIGUN_BARREL_THICKNESS 4.0f
 #define MINIGUN_MUZZLE_SPEED     100.0f
@@ -147,37 +155,20 @@
 #define MINIGUN_MUZZLE_LIFETIME  0.06f
 
 // Sword
-#define SWORD_DURATION          0.16f
-#define SWORD_ARC               (0.9f * 3.14159265f)
-#define SWORD_RADIUS            120.0f
-#define SWORD_DAMAGE            25
-#define SWORD_DASH_DAMAGE       40
 #define DASH_SLASH_ARC_MULT     1.3f
 #define DASH_SLASH_RADIUS_MULT  1.5f
 #define SWORD_DRAW_SEGMENTS     12
 
 // Lunge (M2 for sword)
-#define LUNGE_DURATION          0.18f
-#define LUNGE_RANGE             150.0f
-#define LUNGE_CONE_HALF         0.30f
-#define LUNGE_DAMAGE            30
-#define LUNGE_DASH_DAMAGE       50
-#define LUNGE_SPEED             600.0f
 #define LUNGE_DASH_RANGE_MULT   1.5f
 #define LUNGE_DASH_SPEED_MULT   1.6f
 #define LUNGE_DRAW_SEGMENTS     8
 
 // Dash
-#define DASH_SPEED              1600.0f
-#define DASH_DURATION           0.2f
-#define DASH_COOLDOWN           2.0f
-#define DASH_MAX_CHARGES        3
 #define DASH_GHOST_COUNT        5
 #define DASH_GHOST_SPACING      14.0f
 #define DASH_GHOST_ROT_STEP     0.15f
 #define DASH_BURST_PARTICLES    5
-#define DASH_SUPER_WINDOW       0.12f
-#define DECOY_DURATION          1.6f
 #define DECOY_PULSE_SPEED       8.0f
 #define DECOY_MIN_ALPHA         0.15f
 #define DECOY_MAX_ALPHA         0.45f
@@ -188,80 +179,25 @@
 #define DASH_ORB_SIZE           4.0f    // orb draw radius
 
 // Spin
-#define SPIN_DURATION           0.32f
-#define SPIN_RADIUS             120.0f
-#define SPIN_COOLDOWN           2.0f
-#define SPIN_DAMAGE             25
-#define SPIN_KNOCKBACK          250.0f
-#define SPIN_LIFESTEAL          0.1f
 #define SPIN_DRAW_SEGMENTS      24
 #define SPIN_TRAIL_LENGTH       (PI * 1.5f)
 #define SPIN_INNER_RADIUS_FRAC  0.65f
 
 // Shotgun
-#define SHOTGUN_PELLETS         10
-#define SHOTGUN_SPREAD          0.72f
-#define SHOTGUN_BULLET_SPEED    1400.0f
-#define SHOTGUN_BULLET_LIFETIME 0.20f
-#define SHOTGUN_DAMAGE          10
 #define SHOTGUN_PROJECTILE_SIZE 3.0f
-#define SHOTGUN_KNOCKBACK       350.0f
 #define SHOTGUN_BOUNCES         2
-#define SHOTGUN_BOUNCE_SPEED    0.8f
-#define SHOTGUN_BLASTS          2
-#define SHOTGUN_COOLDOWN        1.5f
 
 // Revolver
-#define REVOLVER_ROUNDS         6
-#define REVOLVER_DAMAGE         22
-#define REVOLVER_COOLDOWN       0.35f
-#define REVOLVER_FAN_COOLDOWN   0.10f
-#define REVOLVER_FAN_SPREAD     120
-#define REVOLVER_RELOAD_TIME    1.2f
-#define REVOLVER_BULLET_SPEED   1800.0f
-#define REVOLVER_BULLET_LIFETIME 2.0f
-#define REVOLVER_PROJECTILE_SIZE 4.0f
-#define REVOLVER_PRECISE_SPREAD  8
 // Active reload
-#define REVOLVER_RELOAD_SWEET_START 0.60f
-#define REVOLVER_RELOAD_SWEET_END   0.75f
-#define REVOLVER_RELOAD_FAST_TIME   0.08f
-#define REVOLVER_RELOAD_FAIL_PENALTY 0.5f
 #define REVOLVER_ARC_COLOR      (Color){ 220, 180, 80, 255 }
 #define RELOAD_HIT_COLOR        (Color){ 60, 255, 60, 120 }
 #define RELOAD_MISS_COLOR       (Color){ 255, 60, 60, 120 }
 #define RELOAD_SWEET_COLOR      (Color){ 255, 255, 100, 100 }
 
 // Rocket Launcher
-#define ROCKET_SPEED            800.0f
-#define ROCKET_LIFETIME         3.0f
-#define ROCKET_DIRECT_DAMAGE    40
-#define ROCKET_EXPLOSION_DAMAGE 60
-#define ROCKET_EXPLOSION_RADIUS 160.0f
-#define ROCKET_KNOCKBACK        250.0f
-#define ROCKET_COOLDOWN         0.715f
 #define ROCKET_SIZE             6.0f
-#define ROCKET_PROJECTILE_SIZE  6.0f
-#define ROCKET_JUMP_DAMAGE      4
-#define ROCKET_JUMP_FORCE       800.0f
-#define ROCKET_JUMP_FRICTION    5.0f
 
 // Grenade Launcher
-#define GRENADE_SPEED               500.0f
-#define GRENADE_DRAG                1.5f
-#define GRENADE_LIFETIME            2.5f
-#define GRENADE_DIRECT_DAMAGE       35
-#define GRENADE_EXPLOSION_DAMAGE    60
-#define GRENADE_EXPLOSION_RADIUS    140.0f
-#define GRENADE_KNOCKBACK           200.0f
-#define GRENADE_COOLDOWN            1.5f
-#define GRENADE_PROJECTILE_SIZE     5.0f
-#define GRENADE_MAX_BOUNCES         2
-#define GRENADE_BOUNCE_DAMPING      0.6f
-#define GRENADE_LAUNCH_HEIGHT_VEL   200.0f
-#define GRENADE_ARC_GRAVITY         500.0f
-#define GRENADE_ARC_BOUNCE_DAMPING  0.5f
-#define GRENADE_ARC_MIN_VEL         20.0f
 #define GRENADE_COLOR               (Color){ 214, 144, 36, 255 }
 #define GRENADE_GLOW_COLOR          (Color){ 255, 180, 50, 255 }
 #define GRENADE_MUZZLE_PARTICLES    6
@@ -270,17 +206,8 @@
 #define GRENADE_MUZZLE_LIFETIME     0.1f
 
 // BFG10k ------------------------------------------------------------------- /
-#define BFG_SPEED                   600.0f
-#define BFG_LIFETIME                3.0f
-#define BFG_PROJECTILE_SIZE         14.0f
-#define BFG_DIRECT_DAMAGE           80
-#define BFG_CHARGE_COST             1000.0f
 #define BFG_COLOR                   (Color){ 120, 220, 255, 255 }
 #define BFG_GLOW_COLOR              (Color){ 80, 160, 255, 100 }
-#define BFG_CHAIN_DAMAGE            100
-#define BFG_CHAIN_RADIUS            400.0f
-#define BFG_HOP_DELAY               0.1f
-#define BFG_ARC_DURATION            0.4f
 #define BFG_MAX_HOPS                256
 #define BFG_MAX_CHAIN_TARGETS       256
 #define BFG_MAX_ARCS                256
@@ -300,24 +227,10 @@
 #define BFG_PULSE_AMOUNT            2.0f
 
 // Shield ------------------------------------------------------------------- /
-#define SHIELD_MAX_HP           200.0f
-#define SHIELD_REGEN_DELAY      1.5f    // seconds after lowering before regen starts
-#define SHIELD_REGEN_RATE       50.0f   // hp/sec regeneration
-#define SHIELD_ARC              PI      // half circle (180 degrees)
-#define SHIELD_RADIUS           60.0f   // distance from player center
-#define SHIELD_SLOW_FACTOR      0.5f    // movement multiplier while shielding
 #define SHIELD_SEGMENTS         16      // draw segments for the arc
 #define SHIELD_COLOR            (Color){ 80, 160, 255, 180 }
-#define SHIELD_BROKEN_COOLDOWN  2.0f    // lockout when shield breaks
 
 // Ground Slam -------------------------------------------------------------- /
-#define SLAM_DAMAGE             15
-#define SLAM_RANGE              300.0f
-#define SLAM_ARC                (PI * 0.417f)   // 75 degree cone
-#define SLAM_KNOCKBACK          250.0f
-#define SLAM_STUN_MIN           0.5f
-#define SLAM_STUN_MAX           2.0f
-#define SLAM_COOLDOWN           6.0f
 #define SLAM_VFX_DURATION       0.2f
 #define SLAM_PARTICLE_SPEED_MIN 200
 #define SLAM_PARTICLE_SPEED_MAX 400
@@ -327,26 +240,11 @@
 #define SLAM_COLOR              (Color){ 255, 200, 60, 255 }
 
 // Parry -------------------------------------------------------------------- /
-#define PARRY_WINDOW            0.75f   // active deflect window
-#define PARRY_COOLDOWN          4.0f    // normal cooldown
-#define PARRY_SUCCESS_COOLDOWN  2.0f    // reduced cooldown on success
 #define PARRY_IFRAMES           0.5f    // iframes granted on success
-#define PARRY_STUN_DURATION     2.75f   // stun applied to enemies on parry
-#define PARRY_KNOCKBACK         400.0f  // knockback on parried contact
 #define PARRY_COLOR             (Color){ 220, 180, 50, 220 }
 
 // Turret ------------------------------------------------------------------- /
-#define TURRET_LIFETIME         1024.0f
-#define TURRET_FIRE_RATE        0.5f
-#define TURRET_RANGE            600.0f
-#define TURRET_DAMAGE           12
-#define TURRET_HP               160
-#define TURRET_BULLET_SPEED     800.0f
-#define TURRET_BULLET_LIFETIME  3.0f
-#define TURRET_BULLET_SIZE      3.0f
-#define TURRET_COOLDOWN         8.0f
 #define TURRET_MAX_ACTIVE       64
-#define TURRET_PLACEMENT_DIST   100.0f
 #define TURRET_MUZZLE_OFFSET    10.0f
 #define TURRET_MUZZLE_SPEED     80.0f
 #define TURRET_MUZZLE_SIZE      2.0f
@@ -354,41 +252,20 @@
 #define TURRET_COLOR            (Color){ 100, 200, 255, 255 }
 
 // Root Mine ---------------------------------------------------------------- /
-#define MINE_LIFETIME           1024.0f
-#define MINE_TRIGGER_RADIUS     40.0f
-#define MINE_ROOT_RADIUS        100.0f
-#define MINE_ROOT_DURATION      3.0f
-#define MINE_COOLDOWN           5.0f
 #define MINE_MAX_ACTIVE         64
 #define MINE_COLOR              (Color){ 255, 100, 100, 255 }
 #define MINE_PULSE_SPEED        4.0f
-#define MINE_WEB_DURATION       MINE_ROOT_DURATION
+#define MINE_WEB_DURATION       TUNE(MINE_ROOT_DURATION)
 #define MINE_WEB_SPOKES         8
 #define MINE_WEB_RINGS          3
 
 // Healing Field ------------------------------------------------------------ /
-#define HEAL_LIFETIME           8.0f
-#define HEAL_RADIUS             160.0f
-#define HEAL_PER_SEC            15.0f
-#define HEAL_COOLDOWN           15.0f
 #define HEAL_MAX_ACTIVE         1
 #define HEAL_COLOR              (Color){ 80, 255, 80, 120 }
 #define HEAL_PULSE_SPEED        3.0f
 
 // Flamethrower ------------------------------------------------------------- /
-#define FLAME_FUEL_MAX          100.0f
-#define FLAME_DRAIN_RATE        40.0f    // fuel/sec while firing
-#define FLAME_REGEN_RATE        12.0f    // fuel/sec regen
-#define FLAME_REGEN_DELAY       1.0f     // seconds after release before regen starts
-#define FLAME_SPRAY_INTERVAL    0.12f    // seconds between patch spawns
-#define FLAME_RANGE             400.0f   // max distance patches land from player
-#define FLAME_SPREAD            0.35f    // radians of cone spread (particles only)
 #define FLAME_JITTER            20       // patch placement jitter in pixels
-#define FLAME_SLOW_FACTOR       0.7f     // move speed while spraying
-#define FLAME_PATCH_LIFETIME    5.0f     // seconds each ground patch lasts
-#define FLAME_PATCH_RADIUS      30.0f    // damage radius per patch
-#define FLAME_PATCH_DPS         30.0f    // damage per second per patch
-#define FLAME_PATCH_TICK        0.2f     // damage tick interval
 #define FLAME_COLOR             (Color){ 255, 120, 30, 150 }
 #define FIRE_EMBER_COLOR        (Color){ 255, 80, 20, 255 }
 #define FIRE_GLOW_COLOR         (Color){ 255, 60, 10, 255 }
@@ -398,11 +275,6 @@
 #define FLAME_PARTICLE_LIFETIME 0.3f
 
 // Blink Dagger ------------------------------------------------------------- /
-#define BLINK_DISTANCE          480.0f      // 1.5x dash distance (320)
-#define BLINK_COOLDOWN          10.0f       // base cd when undamaged
-#define BLINK_COOLDOWN_HIT      3.0f        // cd after taking damage
-#define BLINK_DAMAGE            40
-#define BLINK_DAMAGE_DELAY      1.6f        // seconds before slash damage
 #define BLINK_BEAM_DURATION     0.25f       // trail linger time
 #define BLINK_BEAM_WIDTH        32.0f
 #define BLINK_BEAM_OFFSET       12.0f       // perpendicular spread between lines
@@ -425,11 +297,6 @@
 #endif
 
 // Railgun (press Z, pierce all, long cooldown)
-#define RAILGUN_DAMAGE              200
-#define RAILGUN_RANGE               10000.0f
-#define RAILGUN_COOLDOWN            2.0f
-#define RAILGUN_BEAM_DURATION       0.2f
-#define RAILGUN_BEAM_RADIUS         10.0f   // hurtbox
 #define RAILGUN_BEAM_WIDTH          20.0f   // cosmetic
 #define RAILGUN_GLOW_WIDTH          25.0f    // cosmetic
 #define RAILGUN_COLOR               (Color){ 0, 255, 0, 255 }
@@ -438,33 +305,14 @@
 #define RAILGUN_MUZZLE_PARTICLES    8
 
 // Sniper (press X, single fast projectile, slows target, long cooldown)
-#define SNIPER_DAMAGE           120
 #define SNIPER_BULLET_SPEED     3200.0f
-#define SNIPER_BULLET_LIFETIME  1.5f
-#define SNIPER_PROJECTILE_SIZE  4.0f
 #define SNIPER_COOLDOWN         0.915f
-#define SNIPER_SLOW_FACTOR      0.4f
-#define SNIPER_SLOW_DURATION    2.0f
 #define SNIPER_SPREAD           4
 #define SNIPER_MUZZLE_PARTICLES 6
 #define SNIPER_MUZZLE_SPEED     120.0f
 #define SNIPER_MUZZLE_SIZE      4.0f
 #define SNIPER_MUZZLE_LIFETIME  0.1f
-// Sniper — M1 hip fire
-#define SNIPER_HIP_SPREAD        160       // wide spread (80/1000 rad)
-#define SNIPER_HIP_COOLDOWN      0.915f    // fast semi-auto
-#define SNIPER_HIP_BULLET_SPEED  2000.0f  // slightly slower than aimed
-
-// Sniper — M2 aimed shot (hold M2 + click M1)
-#define SNIPER_AIM_SPREAD        0        // zero
-#define SNIPER_AIM_COOLDOWN      0.915f   // same as hip
-#define SNIPER_AIM_BULLET_SPEED  2800.0f  // faster travel
-#define SNIPER_AIM_SLOW          0.35f    // movement multiplier while ADS
-
 // Sniper — super shot (dash timing + M2)
-#define SNIPER_SUPER_DAMAGE      300      // massive payoff
-#define SNIPER_SUPER_SLOW_DUR    4.0f     // longer debuff on target
-#define SNIPER_SUPER_SLOW_FACTOR 0.2f     // stronger slow (vs normal 0.4)
 #define SNIPER_COLOR            (Color){ 180, 220, 255, 255 }
 #define SNIPER_BULLET_LENGTH    5.0f
 #define SNIPER_BULLET_WIDTH     1.1f
@@ -475,10 +323,8 @@
 
 // Enemies ------------------------------------------------------------------ /
 // Spawning
-#define SPAWN_INTERVAL          2.0f
 #define SPAWN_RAMP              0.98f
 #define SPAWN_MIN_INTERVAL      0.4f
-#define SPAWN_MARGIN            400.0f
 // Spawn unlock curve (kills required before type can appear)
 #define RECT_SPAWN_KILLS        5
 #define OCTA_SPAWN_KILLS        40
@@ -486,8 +332,6 @@
 #define HEXA_SPAWN_KILLS        25
 #define PENTA_SPAWN_KILLS       30
 #define TRAP_SPAWN_KILLS        50
-// Boss
-#define BOSS_KILL_THRESHOLD     100
 
 // Enemy pod values
 #define TRI_VALUE               1
@@ -506,6 +350,7 @@
 #define TRI_SPEED_VAR           80
 #define TRI_CONTACT_DAMAGE      15
 #define TRI_GOLD                100
+#define TRI_MASS                1.0f    // separation push weight
 #define TRI_WING_ANGLE          2.4f
 
 // Enemy — Rectangle (ranged)
@@ -514,13 +359,9 @@
 #define RECT_SPEED_MIN          55.0f
 #define RECT_SPEED_VAR          30
 #define RECT_CONTACT_DAMAGE     18
-#define RECT_SHOOT_INTERVAL     0.9f
-#define RECT_BULLET_SPEED       300.0f
-#define RECT_BULLET_DAMAGE      12
-#define RECT_PROJECTILE_SIZE    4.0f
-#define RECT_BULLET_LIFETIME    10.0f
 #define RECT_ASPECT_RATIO       0.7f
 #define RECT_GOLD               200
+#define RECT_MASS               2.0f
 
 // Enemy — Rhombus (fast chaser)
 #define RHOM_SIZE               15.0f
@@ -529,6 +370,7 @@
 #define RHOM_SPEED_VAR          100
 #define RHOM_CONTACT_DAMAGE     22
 #define RHOM_GOLD               300
+#define RHOM_MASS               1.0f
 #define RHOM_COLOR              (Color){ 160, 32, 240, 255 }
 #define RHOM_TIP_MULT           1.2f
 #define RHOM_BACK_MULT          0.8f
@@ -541,7 +383,6 @@
 #define PENTA_SPEED_MIN         40.0f
 #define PENTA_SPEED_VAR         20
 #define PENTA_CONTACT_DAMAGE    24
-#define PENTA_SHOOT_INTERVAL    2.5f
 #define PENTA_BULLET_SPEED      350.0f
 #define PENTA_BULLET_DAMAGE     8
 #define PENTA_PROJECTILE_SIZE   5.0f
@@ -549,6 +390,7 @@
 #define PENTA_ROW_OFFSET        14.0f
 #define PENTA_BULLET_SPACING    18.0f
 #define PENTA_GOLD              600
+#define PENTA_MASS              3.0f
 #define PENTA_COLOR             (Color){ 57, 255, 20, 255 }
 #define PENTA_BULLETS_PER_ROW   5
 
@@ -558,7 +400,6 @@
 #define HEXA_SPEED_MIN          90.0f
 #define HEXA_SPEED_VAR          30
 #define HEXA_CONTACT_DAMAGE     18
-#define HEXA_SHOOT_INTERVAL     2.0f
 #define HEXA_BULLET_SPEED       300.0f
 #define HEXA_BULLET_DAMAGE      7
 #define HEXA_PROJECTILE_SIZE    4.0f
@@ -567,6 +408,7 @@
 #define HEXA_FAN_SPREAD         0.7854f
 #define HEXA_ORBIT_DIST         280.0f
 #define HEXA_GOLD               600
+#define HEXA_MASS               2.0f
 #define HEXA_COLOR              (Color){ 255, 160, 30, 255 }
 #define HEXA_OUTLINE_COLOR      (Color){ 180, 100, 10, 255 }
 
@@ -577,6 +419,7 @@
 #define OCTA_SPEED_VAR          100
 #define OCTA_CONTACT_DAMAGE     33
 #define OCTA_GOLD               300
+#define OCTA_MASS               1.5f
 #define OCTA_COLOR              (Color){ 255, 0, 0, 255 }
 #define OCTA_OUTLINE_COLOR      (Color){ 180, 100, 10, 255 }
 
@@ -587,14 +430,13 @@
 #define TRAP_SPEED_VAR          0
 #define TRAP_CONTACT_DAMAGE     30
 #define TRAP_GOLD               5000
+#define TRAP_MASS               20.0f
 #define TRAP_COLOR              (Color){ 255, 200, 50, 255 }
 #define TRAP_OUTLINE_COLOR      (Color){ 180, 120, 20, 255 }
 // Shape proportions
 #define TRAP_FRONT_WIDTH        0.5f    // narrow front half-width (× size)
 #define TRAP_BACK_WIDTH         1.0f    // wide back half-width (× size)
 #define TRAP_LENGTH             1.2f    // half-length front to back (× size)
-// Attack timing
-#define TRAP_ATTACK_INTERVAL    2.5f
 // Aimed burst
 #define TRAP_BURST_COUNT        5
 #define TRAP_BURST_SPREAD       0.5f
@@ -606,61 +448,24 @@
 #define TRAP_RING_COUNT         12
 #define TRAP_RING_SPEED         300.0f
 #define TRAP_RING_DAMAGE        12
-// Charge + slam
-#define TRAP_CHARGE_SPEED       600.0f
-#define TRAP_CHARGE_DURATION    0.6f
-#define TRAP_SLAM_RADIUS        120.0f
-#define TRAP_SLAM_DAMAGE        25
 
 // Enemy — Circle (big boss, shadow of the player)
 #define CIRC_SIZE               PLAYER_SIZE
-#define CIRC_HP                 PLAYER_HP * 10
-#define CIRC_SPEED_MIN          PLAYER_SPEED
+#define CIRC_HP                 1000    // 10x the base PLAYER_HP
+#define CIRC_SPEED_MIN          300.0f  // the base PLAYER_SPEED
 #define CIRC_SPEED_VAR          0
 #define CIRC_CONTACT_DAMAGE     30
 #define CIRC_GOLD               10000
+#define CIRC_MASS               50.0f
 #define CIRC_VALUE              0
 #define CIRC_COLOR              WHITE
 #define CIRC_OUTLINE_COLOR      LIGHTGRAY
-// Attack timing
-#define CIRC_ATTACK_INTERVAL    2.0f
 // Dash (charge)
-#define CIRC_CHARGE_SPEED       DASH_SPEED
-#define CIRC_CHARGE_DURATION    DASH_DURATION
+#define CIRC_CHARGE_SPEED       TUNE(DASH_SPEED)
+#define CIRC_CHARGE_DURATION    TUNE(DASH_DURATION)
 #define CIRC_SLAM_RADIUS        100.0f
-#define CIRC_SLAM_DAMAGE        20
 // Sword sweep
-#define CIRC_SWORD_DASH_DURATION 0.12f
-#define CIRC_SWORD_DURATION     0.25f
 #define CIRC_SWORD_ARC          (0.9f * PI)
-#define CIRC_SWORD_RADIUS       130.0f
-#define CIRC_SWORD_DAMAGE       30
-// Gun burst
-#define CIRC_GUN_BURST_DURATION 1.0f
-#define CIRC_GUN_FIRE_RATE      0.06f
-#define CIRC_GUN_SPREAD         80
-#define CIRC_GUN_SPEED          800.0f
-#define CIRC_GUN_DAMAGE         8
-#define CIRC_GUN_LIFETIME       3.0f
-#define CIRC_GUN_SIZE           3.0f
-// Revolver fan
-#define CIRC_REV_COUNT          6
-#define CIRC_REV_SPREAD         120
-#define CIRC_REV_FAN_COOLDOWN   0.10f
-#define CIRC_REV_SPEED          1200.0f
-#define CIRC_REV_DAMAGE         15
-#define CIRC_REV_LIFETIME       2.0f
-#define CIRC_REV_SIZE           4.0f
-// Sniper shot
-#define CIRC_SNIPER_SPEED       2400.0f
-#define CIRC_SNIPER_DAMAGE      40
-#define CIRC_SNIPER_LIFETIME    1.5f
-#define CIRC_SNIPER_SIZE        4.0f
-// Rocket
-#define CIRC_ROCKET_SPEED       600.0f
-#define CIRC_ROCKET_DAMAGE      30
-#define CIRC_ROCKET_LIFETIME    3.0f
-#define CIRC_ROCKET_SIZE        6.0f
 // Ring wave
 #define CIRC_RING_COUNT         16
 #define CIRC_RING_SPEED         250.0f
@@ -692,6 +497,15 @@
 #define PARTICLE_BURST_SIZE_MIN     2
 #define PARTICLE_BURST_SIZE_MAX     5
 #define PARTICLE_BURST_LIFETIME     0.4f
+// Governor, frame time over budget thins particle spawns, never the sim
+#define PARTICLE_FRAME_BUDGET       0.022f  // s, ~45 fps, 50hz screens stay clear
+#define PARTICLE_GOVERN_SMOOTH      0.1f    // ema weight for frame time
+#define PARTICLE_GOVERN_DROP        2.0f    // scale lost per second over budget
+#define PARTICLE_GOVERN_RECOVER     0.5f    // scale regained per second under
+#define PARTICLE_SCALE_MIN          0.1f
+// Batched draw, one textured quad per particle
+#define PARTICLE_SPRITE_SIZE        32      // baked circle the quads sample
+#define PARTICLE_DRAW_BATCH         1024    // quads per rlBegin, web batch is 2048
 
 // Hit / Death
 #define HIT_FLASH_DURATION          0.1f
@@ -778,6 +592,8 @@
 #define SHAPE_SAT_DEFAULT       1.0f
 #define SHAPE_SAT_CUBE          0.85f
 #define SHAPE_SAT_DODECA        0.85f
+#define SHAPE_SUBDIV_MAX        8       // grid arrays in SubdivDrawTri/Quad
+#define HUE_LUT_STEPS           4       // hue table entries per degree
 // Sphere (weapon select unselected player)
 #define SPHERE_SLICES           12
 #define SPHERE_STACKS           8
@@ -861,6 +677,13 @@
 // FPS
 #define HUD_FPS_FONT            16
 #define HUD_FPS_X               80
+// Debug stats overlay (F3)
+#define HUD_STATS_Y             120
+#define HUD_STATS_FONT          9
+#define HUD_STATS_LINE          11
+#define HUD_STATS_W             300
+#define HUD_STATS_BG            (Color){ 0, 0, 0, 160 }
+#define HUD_STATS_ASSET         96      // blob texture preview, tall side
 // Crosshair
 #define HUD_CROSSHAIR_SIZE      4.0f
 #define HUD_CROSSHAIR_THICKNESS 1.0f
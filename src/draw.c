@@ -1,6 +1,7 @@
 // draw.c
 // render the game state as pixels
 #include "game.h"
+#include "rlgl.h"
 
 static const char* AbilityName(AbilityID id) {
     switch (id) {
@@ -113,28 +114,71 @@ static const char* WeaponName(WeaponType w) {
 
 // Draw - Rainbow cube (fake 3D, subdivided gradient faces)
 // Manual HSV conversion to ensure no dependency issues in web build
-static Color HsvToRgb(float h, float s, float v, float alpha) {
-    if (h < 0.0f) h = fmodf(h, 360.0f) + 360.0f;
-    else if (h >= 360.0f) h = fmodf(h, 360.0f);
-    
-    float c = v * s;
-    float x = c * (1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f));
-    float m = v - c;
-    
-    float r = 0, g = 0, b = 0;
-    if (h < 60) { r = c; g = x; b = 0; }
-    else if (h < 120) { r = x; g = c; b = 0; }
-    else if (h < 180) { r = 0; g = c; b = x; }
-    else if (h < 240) { r = 0; g = x; b = c; }
-    else if (h < 300) { r = x; g = 0; b = c; }
-    else { r = c; g = 0; b = x; }
-    
-    return (Color){
-        (u8)((r + m) * 255.0f),
-        (u8)((g + m) * 255.0f),
-        (u8)((b + m) * 255.0f),
-        (u8)(alpha * 255.0f)
-    };
+// value is always 1 here, so a hue -> rgb table at full saturation covers
+// every solid: with v = 1, channel = pure * sat + (1 - sat)
+// the table runs two turns so a face's hues get shifted into [0, 720) once
+// and never wrapped per sub-triangle. hsv is piecewise linear in hue with
+// knots every 60 degrees, those land on entries, so the lerp is exact
+#define HUE_LUT_N   (720 * HUE_LUT_STEPS + 2)
+static float hueLut[3][HUE_LUT_N];
+static bool hueLutReady;
+
+static void BuildHueLut(void)
+{
+    for (int i = 0; i < HUE_LUT_N; i++) {
+        float h = fmodf((float)i / HUE_LUT_STEPS, 360.0f);
+        float x = 1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f);
+        float r = 0, g = 0, b = 0;
+        if (h < 60) { r = 1; g = x; }
+        else if (h < 120) { r = x; g = 1; }
+        else if (h < 180) { g = 1; b = x; }
+        else if (h < 240) { g = x; b = 1; }
+        else if (h < 300) { r = x; b = 1; }
+        else { r = 1; b = x; }
+        hueLut[0][i] = r;
+        hueLut[1][i] = g;
+        hueLut[2][i] = b;
+    }
+    hueLutReady = true;
+}
+
+// n hues in [0, 720) to colors, no branches or fmodf so it vectorizes
+static void HuesToRgb(
+    const float *hue, int n, float sat, float alpha, Color *out)
+{
+    if (!hueLutReady) BuildHueLut();
+    float m = 1.0f - sat;
+    u8 a = (u8)(alpha * 255.0f);
+    for (int i = 0; i < n; i++) {
+        float t = hue[i] * HUE_LUT_STEPS;
+        int k = (int)t;
+        k = k < 0 ? 0 : k > HUE_LUT_N - 2 ? HUE_LUT_N - 2 : k;
+        float f = t - (float)k;
+        float r = hueLut[0][k] + (hueLut[0][k + 1] - hueLut[0][k]) * f;
+        float g = hueLut[1][k] + (hueLut[1][k + 1] - hueLut[1][k]) * f;
+        float b = hueLut[2][k] + (hueLut[2][k + 1] - hueLut[2][k]) * f;
+        out[i] = (Color){
+            (u8)((r * sat + m) * 255.0f),
+            (u8)((g * sat + m) * 255.0f),
+            (u8)((b * sat + m) * 255.0f),
+            a };
+    }
+}
+
+// one hue, any range
+static Color HueToRgb(float h, float sat, float alpha)
+{
+    h -= 360.0f * floorf(h / 360.0f);
+    Color c;
+    HuesToRgb(&h, 1, sat, alpha, &c);
+    return c;
+}
+
+// whole turns to take off a face's hues so they all land in [0, 720)
+// spreads across one face stay under a turn for every solid
+static float HueBase(float lo)
+{
+    return 360.0f * floorf(lo / 360.0f);
 }
 
 // shape helpers ---------------------------------------------------------- /
@@ -157,38 +201,43 @@ static void ProjectVertices(
     }
 }
 
+// every sub-triangle takes the color of one grid point (its first corner,
+// the flipped ones their far corner), so the face's colors are one batch
+// over the (N+1)^2 grid, then the triangles just read them
 static void SubdivDrawTri(
     Vector2 p0, Vector2 p1, Vector2 p2,
     float h0, float h1, float h2,
     int N, float sat, float alpha)
 {
+    if (N > SHAPE_SUBDIV_MAX) N = SHAPE_SUBDIV_MAX;
+    enum { CELLS = (SHAPE_SUBDIV_MAX + 1) * (SHAPE_SUBDIV_MAX + 1) };
+    Vector2 q[CELLS];
+    float hue[CELLS];
+    Color col[CELLS];
+    int W = N + 1;
+    float base = HueBase(fminf(h0, fminf(h1, h2)));
+    h0 -= base; h1 -= base; h2 -= base;
+    // full square, the corners past the diagonal are never drawn but it
+    // keeps the color batch one flat run
+    for (int row = 0; row <= N; row++) {
+        for (int c = 0; c <= N; c++) {
+            float u = (float)c / N;
+            float v = (float)row / N;
+            float w = 1.0f - u - v;
+            q[row * W + c] = (Vector2){ w*p0.x + u*p1.x + v*p2.x,
+                                        w*p0.y + u*p1.y + v*p2.y };
+            hue[row * W + c] = w*h0 + u*h1 + v*h2;
+        }
+    }
+    HuesToRgb(hue, W * W, sat, alpha, col);
+
     for (int row = 0; row < N; row++) {
-        for (int col = 0; col < N - row; col++) {
-            float u0 = (float)col / N;
-            float v0 = (float)row / N;
-            float w0 = 1.0f - u0 - v0;
-            float u1 = (float)(col + 1) / N;
-            float v1 = (float)row / N;
-            float w1 = 1.0f - u1 - v1;
-            float u2 = (float)col / N;
-            float v2 = (float)(row + 1) / N;
-            float w2 = 1.0f - u2 - v2;
-
-            Vector2 q0 = { w0*p0.x + u0*p1.x + v0*p2.x, w0*p0.y + u0*p1.y + v0*p2.y };
-            Vector2 q1 = { w1*p0.x + u1*p1.x + v1*p2.x, w1*p0.y + u1*p1.y + v1*p2.y };
-            Vector2 q2 = { w2*p0.x + u2*p1.x + v2*p2.x, w2*p0.y + u2*p1.y + v2*p2.y };
-
-            float hC = fmodf(w0*h0 + u0*h1 + v0*h2 + 360.0f, 360.0f);
-            DrawTriangle(q0, q1, q2, HsvToRgb(hC, sat, 1.0f, alpha));
-
-            if (col + 1 < N - row) {
-                float u3 = (float)(col + 1) / N;
-                float v3 = (float)(row + 1) / N;
-                float w3 = 1.0f - u3 - v3;
-                Vector2 q3 = { w3*p0.x + u3*p1.x + v3*p2.x, w3*p0.y + u3*p1.y + v3*p2.y };
-                float hC2 = fmodf(w3*h0 + u3*h1 + v3*h2 + 360.0f, 360.0f);
-                DrawTriangle(q1, q3, q2, HsvToRgb(hC2, sat, 1.0f, alpha));
-            }
+        for (int c = 0; c < N - row; c++) {
+            int i0 = row * W + c;
+            DrawTriangle(q[i0], q[i0 + 1], q[i0 + W], col[i0]);
+            if (c + 1 < N - row)
+                DrawTriangle(q[i0 + 1], q[i0 + W + 1], q[i0 + W],
+                    col[i0 + W + 1]);
         }
     }
 }
@@ -200,19 +249,36 @@ static void SubdivDrawQuad(
 {
     #define BILERP(A,B,C,D,u,v) \
         ((1-(v))*((1-(u))*(A) + (u)*(B)) + (v)*((1-(u))*(D) + (u)*(C)))
+    if (N > SHAPE_SUBDIV_MAX) N = SHAPE_SUBDIV_MAX;
+    enum { W = SHAPE_SUBDIV_MAX + 1 };
+    Vector2 q[W * W];
+    float hue[SHAPE_SUBDIV_MAX * SHAPE_SUBDIV_MAX];
+    Color col[SHAPE_SUBDIV_MAX * SHAPE_SUBDIV_MAX];
+    float base = HueBase(fminf(fminf(h0, h1), fminf(h2, h3)));
+    h0 -= base; h1 -= base; h2 -= base; h3 -= base;
+    for (int gy = 0; gy <= N; gy++) {
+        for (int gx = 0; gx <= N; gx++) {
+            float u = (float)gx / N, v = (float)gy / N;
+            q[gy * W + gx] = (Vector2){ BILERP(p0.x,p1.x,p2.x,p3.x,u,v),
+                                        BILERP(p0.y,p1.y,p2.y,p3.y,u,v) };
+        }
+    }
+    // cell colors sample the hue at the cell center
+    for (int gy = 0; gy < N; gy++) {
+        for (int gx = 0; gx < N; gx++) {
+            float uc = ((float)gx / N + (float)(gx + 1) / N) * 0.5f;
+            float vc = ((float)gy / N + (float)(gy + 1) / N) * 0.5f;
+            hue[gy * N + gx] = BILERP(h0, h1, h2, h3, uc, vc);
+        }
+    }
+    HuesToRgb(hue, N * N, sat, alpha, col);
+
     for (int gy = 0; gy < N; gy++) {
         for (int gx = 0; gx < N; gx++) {
-            float u0 = (float)gx / N, u1 = (float)(gx + 1) / N;
-            float v0 = (float)gy / N, v1 = (float)(gy + 1) / N;
-            Vector2 q00 = { BILERP(p0.x,p1.x,p2.x,p3.x,u0,v0), BILERP(p0.y,p1.y,p2.y,p3.y,u0,v0) };
-            Vector2 q10 = { BILERP(p0.x,p1.x,p2.x,p3.x,u1,v0), BILERP(p0.y,p1.y,p2.y,p3.y,u1,v0) };
-            Vector2 q11 = { BILERP(p0.x,p1.x,p2.x,p3.x,u1,v1), BILERP(p0.y,p1.y,p2.y,p3.y,u1,v1) };
-            Vector2 q01 = { BILERP(p0.x,p1.x,p2.x,p3.x,u0,v1), BILERP(p0.y,p1.y,p2.y,p3.y,u0,v1) };
-            float uc = (u0 + u1) * 0.5f, vc = (v0 + v1) * 0.5f;
-            float hC = BILERP(h0, h1, h2, h3, uc, vc);
-            Color cc = HsvToRgb(hC, sat, 1.0f, alpha);
-            DrawTriangle(q00, q10, q11, cc);
-            DrawTriangle(q00, q11, q01, cc);
+            int i = gy * W + gx;
+            Color cc = col[gy * N + gx];
+            DrawTriangle(q[i], q[i + 1], q[i + W + 1], cc);
+            DrawTriangle(q[i], q[i + W + 1], q[i + W], cc);
         }
     }
     #undef BILERP
@@ -543,9 +609,9 @@ static void DrawSphere2D(
         float cross = (pj[b].x-pj[a].x)*(pj[c].y-pj[a].y) -
                        (pj[b].y-pj[a].y)*(pj[c].x-pj[a].x);
         if (cross < 0) {
-            float hC = fmodf((hues[a] + hues[b] + hues[c]) / 3.0f, 360.0f);
+            float hC = (hues[a] + hues[b] + hues[c]) / 3.0f;
             DrawTriangle(pj[a], pj[b], pj[c],
-                HsvToRgb(hC, SHAPE_SAT_DEFAULT, 1.0f, alpha));
+                HueToRgb(hC, SHAPE_SAT_DEFAULT, alpha));
         }
     }
 
@@ -562,20 +628,18 @@ static void DrawSphere2D(
             float cross1 = (pj[below].x-pj[curr].x)*(pj[next].y-pj[curr].y) -
                             (pj[below].y-pj[curr].y)*(pj[next].x-pj[curr].x);
             if (cross1 < 0) {
-                float hC = fmodf((hues[curr]+hues[below]+hues[next]) / 3.0f,
-                    360.0f);
+                float hC = (hues[curr]+hues[below]+hues[next]) / 3.0f;
                 DrawTriangle(pj[curr], pj[below], pj[next],
-                    HsvToRgb(hC, SHAPE_SAT_DEFAULT, 1.0f, alpha));
+                    HueToRgb(hC, SHAPE_SAT_DEFAULT, alpha));
             }
 
             // Triangle 2: next, below, belowNext
             float cross2 = (pj[below].x-pj[next].x)*(pj[belowNext].y-pj[next].y) -
                             (pj[below].y-pj[next].y)*(pj[belowNext].x-pj[next].x);
             if (cross2 < 0) {
-                float hC = fmodf((hues[next]+hues[below]+hues[belowNext]) / 3.0f,
-                    360.0f);
+                float hC = (hues[next]+hues[below]+hues[belowNext]) / 3.0f;
                 DrawTriangle(pj[next], pj[below], pj[belowNext],
-                    HsvToRgb(hC, SHAPE_SAT_DEFAULT, 1.0f, alpha));
+                    HueToRgb(hC, SHAPE_SAT_DEFAULT, alpha));
             }
         }
     }
@@ -589,9 +653,9 @@ static void DrawSphere2D(
         float cross = (pj[b].x-pj[a].x)*(pj[c].y-pj[a].y) -
                        (pj[b].y-pj[a].y)*(pj[c].x-pj[a].x);
         if (cross < 0) {
-            float hC = fmodf((hues[a] + hues[b] + hues[c]) / 3.0f, 360.0f);
+            float hC = (hues[a] + hues[b] + hues[c]) / 3.0f;
             DrawTriangle(pj[a], pj[b], pj[c],
-                HsvToRgb(hC, SHAPE_SAT_DEFAULT, 1.0f, alpha));
+                HueToRgb(hC, SHAPE_SAT_DEFAULT, alpha));
         }
     }
 
@@ -624,14 +688,14 @@ static void DrawPlayerSolid(Vector2 pos, float size, float rotY, float rotX, flo
 }
 
 // projectile rendering ----------------------------------------------------- /
-static void DrawProjectiles(void)
+static void DrawPlayerShots(void)
 {
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        Projectile *b = &g.projectiles[i];
+    for (int i = 0; i < g.pool[POOL_PLAYER_SHOT].count; i++) {
+        Projectile *b = &g.playerShots[i];
         if (!b->active) continue;
 
         // sniper .50 cal bullet — elongated pointed shape
-        if (b->dmgType == DMG_PIERCE && !b->isEnemy) {
+        if (b->dmgType == DMG_PIERCE) {
             Vector2 fwd = Vector2Normalize(b->vel);
             Vector2 perp = { -fwd.y, fwd.x };
             float len = b->size * SNIPER_BULLET_LENGTH;
@@ -661,15 +725,31 @@ static void DrawProjectiles(void)
             DrawCircleV(drawPos, b->size, GRENADE_COLOR);
             DrawCircleLinesV(drawPos, b->size + 1.0f, GRENADE_GLOW_COLOR);
         } else {
-            Color bColor = b->isEnemy ? MAGENTA : YELLOW;
-            float bSize = b->size;
-            DrawCircleV(b->pos, bSize, bColor);
+            DrawCircleV(b->pos, b->size, YELLOW);
             Vector2 trail = Vector2Subtract(b->pos, Vector2Scale(b->vel, BULLET_TRAIL_FACTOR));
-            DrawLineV(trail, b->pos, Fade(bColor, 0.5f));
+            DrawLineV(trail, b->pos, Fade(YELLOW, 0.5f));
         }
     }
 }
 
+// enemy shots are all plain bullets on screen, rockets included
+static void DrawEnemyShots(void)
+{
+    for (int i = 0; i < g.pool[POOL_ENEMY_SHOT].count; i++) {
+        Projectile *b = &g.enemyShots[i];
+        if (!b->active) continue;
+        DrawCircleV(b->pos, b->size, MAGENTA);
+        Vector2 trail = Vector2Subtract(b->pos, Vector2Scale(b->vel, BULLET_TRAIL_FACTOR));
+        DrawLineV(trail, b->pos, Fade(MAGENTA, 0.5f));
+    }
+}
+
+static void DrawProjectiles(void)
+{
+    DrawPlayerShots();
+    DrawEnemyShots();
+}
+
 // sword arc rendering ------------------------------------------------------ /
 static void DrawSwordArc(Vector2 origin, float timer, float duration,
                          float angle, float arc, float radius, Color color)
@@ -702,7 +782,7 @@ static void DrawSwordArc(Vector2 origin, float timer, float duration,
 
 static void DrawDeployables(void)
 {
-    for (int i = 0; i < MAX_DEPLOYABLES; i++) {
+    for (int i = 0; i < g.pool[POOL_DEPLOYABLE].count; i++) {
         Deployable *d = &g.deployables[i];
         if (!d->active) continue;
         float t = (float)GetTime();
@@ -722,7 +802,7 @@ static void DrawDeployables(void)
                 DrawLineEx(p0, p1, TURRET_VIS_THICKNESS, (Color)TURRET_COLOR);
             }
             // HP bar
-            float hpFrac = (float)d->hp / TURRET_HP;
+            float hpFrac = (float)d->hp / TUNE(TURRET_HP);
             float barW = TURRET_HPBAR_W, barH = TURRET_HPBAR_H;
             Vector2 barPos = { d->pos.x - barW * 0.5f, d->pos.y + TURRET_HPBAR_YOFFSET };
             DrawRectangleV(barPos, (Vector2){ barW, barH },
@@ -747,7 +827,7 @@ static void DrawDeployables(void)
                 Fade((Color)HEAL_COLOR, 0.4f));
         } break;
         case DEPLOY_FIRE: {
-            float life = d->timer / FLAME_PATCH_LIFETIME;
+            float life = d->timer / TUNE(FLAME_PATCH_LIFETIME);
             float fade = (life > FIRE_PATCH_FADE_THRESH) ? 1.0f : life / FIRE_PATCH_FADE_THRESH;
             float r = d->radius;
             int embers = FIRE_PATCH_EMBER_COUNT;
@@ -790,7 +870,7 @@ static void DrawVfxTimers(void)
         switch (vt->type) {
         case VFX_MINE_WEB: {
             float alpha = t;
-            float r = MINE_ROOT_RADIUS;
+            float r = TUNE(MINE_ROOT_RADIUS);
             for (int s = 0; s < MINE_WEB_SPOKES; s++) {
                 float a = s * (2.0f * PI / MINE_WEB_SPOKES);
                 Vector2 tip = { vt->pos.x + cosf(a) * r,
@@ -812,7 +892,8 @@ static void DrawVfxTimers(void)
         } break;
         case VFX_EXPLOSION: {
             float alpha = t * EXPLOSION_RING_ALPHA;
-            float radius = ROCKET_EXPLOSION_RADIUS * (1.0f - t * EXPLOSION_RING_DECAY);
+            float radius = TUNE(ROCKET_EXPLOSION_RADIUS)
+                * (1.0f - t * EXPLOSION_RING_DECAY);
             DrawCircleLinesV(vt->pos, radius, Fade(ORANGE, alpha));
             DrawCircleLinesV(vt->pos, radius - 2.0f, Fade(RED, alpha * 0.6f));
         } break;
@@ -859,7 +940,7 @@ static void DrawLightning(void)
 
 static void DrawEnemies(void)
 {
-    for (int i = 0; i < MAX_ENEMIES; i++) {
+    for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
         Enemy *e = &g.enemies[i];
         if (!e->active) continue;
 
@@ -1001,8 +1082,8 @@ static void DrawEnemies(void)
                 e->size, CIRC_OUTLINE_COLOR);
             if (e->sweepTimer > 0) {
                 DrawSwordArc(e->pos, e->sweepTimer,
-                    CIRC_SWORD_DURATION, e->sweepAngle,
-                    CIRC_SWORD_ARC, CIRC_SWORD_RADIUS, RED);
+                    TUNE(CIRC_SWORD_DURATION), e->sweepAngle,
+                    CIRC_SWORD_ARC, TUNE(CIRC_SWORD_RADIUS), RED);
             }
         } break;
         default: break;
@@ -1010,7 +1091,7 @@ static void DrawEnemies(void)
 
         // Blink dagger slash mark
         if (e->blinkMark > 0) {
-            float mt = e->blinkMark / BLINK_DAMAGE_DELAY;
+            float mt = e->blinkMark / TUNE(BLINK_DAMAGE_DELAY);
             float r = e->size * 1.2f;
             Color mc = { BLINK_COLOR.r, BLINK_COLOR.g, BLINK_COLOR.b,
                          (u8)(255.0f * mt) };
@@ -1052,7 +1133,7 @@ static void DrawPlayer(void)
 
     if (visible) {
         float t = (float)GetTime();
-        float rotY = t * PLAYER_ROT_SPEED;
+        float rotY = t * TUNE(PLAYER_ROT_SPEED);
         float rotX = PLAYER_ROT_TILT;
 
         // Ghost trail during dash
@@ -1093,18 +1174,20 @@ static void DrawPlayer(void)
 
         // Shield arc
         if (p->shield.active && p->shield.hp > 0) {
-            float shieldAlpha = p->shield.hp / p->shield.maxHp;
-            float startAngle = p->shield.angle - SHIELD_ARC / 2.0f;
-            float innerR = SHIELD_RADIUS * 0.85f;
+            float shieldAlpha = p->shield.hp / TUNE(SHIELD_MAX_HP);
+            float startAngle = p->shield.angle - TUNE(SHIELD_ARC) / 2.0f;
+            float innerR = TUNE(SHIELD_RADIUS) * 0.85f;
             for (int si = 0; si < SHIELD_SEGMENTS; si++) {
-                float a0 = startAngle + SHIELD_ARC * (float)si / SHIELD_SEGMENTS;
-                float a1 = startAngle + SHIELD_ARC * (float)(si + 1) / SHIELD_SEGMENTS;
+                float a0 = startAngle + TUNE(SHIELD_ARC) * (float)si / SHIELD_SEGMENTS;
+                float a1 = startAngle + TUNE(SHIELD_ARC) * (float)(si + 1) / SHIELD_SEGMENTS;
                 float c0 = cosf(a0), s0 = sinf(a0);
                 float c1 = cosf(a1), s1 = sinf(a1);
                 // Outer arc
                 DrawLineEx(
-                    (Vector2){ p->pos.x + c0 * SHIELD_RADIUS, p->pos.y + s0 * SHIELD_RADIUS },
-                    (Vector2){ p->pos.x + c1 * SHIELD_RADIUS, p->pos.y + s1 * SHIELD_RADIUS },
+                    (Vector2){ p->pos.x + c0 * TUNE(SHIELD_RADIUS),
+                               p->pos.y + s0 * TUNE(SHIELD_RADIUS) },
+                    (Vector2){ p->pos.x + c1 * TUNE(SHIELD_RADIUS),
+                               p->pos.y + s1 * TUNE(SHIELD_RADIUS) },
                     3.0f, Fade((Color)SHIELD_COLOR, shieldAlpha));
                 // Inner glow arc
                 DrawLineEx(
@@ -1117,15 +1200,15 @@ static void DrawPlayer(void)
         // Ground Slam expanding cone
         if (p->slam.vfxTimer > 0) {
             float progress = 1.0f - (p->slam.vfxTimer / SLAM_VFX_DURATION);
-            float r = SLAM_RANGE * progress;
+            float r = TUNE(SLAM_RANGE) * progress;
             float alpha = 1.0f - progress;
-            float halfArc = SLAM_ARC * 0.5f;
+            float halfArc = TUNE(SLAM_ARC) * 0.5f;
             float a = p->slam.angle;
             int segs = SLAM_VIS_SEGMENTS;
             // outer arc
             for (int i = 0; i < segs; i++) {
-                float a0 = a - halfArc + (float)i / segs * SLAM_ARC;
-                float a1 = a - halfArc + (float)(i + 1) / segs * SLAM_ARC;
+                float a0 = a - halfArc + (float)i / segs * TUNE(SLAM_ARC);
+                float a1 = a - halfArc + (float)(i + 1) / segs * TUNE(SLAM_ARC);
                 Vector2 p0 = Vector2Add(p->pos,
                     (Vector2){ cosf(a0) * r, sinf(a0) * r });
                 Vector2 p1 = Vector2Add(p->pos,
@@ -1143,7 +1226,7 @@ static void DrawPlayer(void)
 
         // Parry active flash
         if (p->parry.active) {
-            float alpha = p->parry.timer / PARRY_WINDOW;
+            float alpha = p->parry.timer / TUNE(PARRY_WINDOW);
             DrawCircleLinesV(p->pos, p->size + 20.0f,
                 Fade((Color)PARRY_COLOR, alpha));
             DrawCircleLinesV(p->pos, p->size + 16.0f,
@@ -1151,16 +1234,16 @@ static void DrawPlayer(void)
         }
 
         // Dash orbs (diegetic charge display)
-        for (int i = 0; i < p->dash.maxCharges; i++) {
-            float a = p->dash.orbAngle + i * (2.0f * PI / p->dash.maxCharges);
+        for (int i = 0; i < TUNE(DASH_MAX_CHARGES); i++) {
+            float a = p->dash.orbAngle + i * (2.0f * PI / TUNE(DASH_MAX_CHARGES));
             Vector2 orbPos = {
                 p->pos.x + cosf(a) * DASH_ORB_RADIUS,
                 p->pos.y + sinf(a) * DASH_ORB_RADIUS
             };
             if (i < p->dash.charges) {
                 DrawCircleV(orbPos, DASH_ORB_SIZE, SKYBLUE);
-            } else if (i == p->dash.charges && p->dash.charges < p->dash.maxCharges) {
-                float ratio = 1.0f - p->dash.rechargeTimer / p->dash.rechargeTime;
+            } else if (i == p->dash.charges && p->dash.charges < TUNE(DASH_MAX_CHARGES)) {
+                float ratio = 1.0f - p->dash.rechargeTimer / TUNE(DASH_COOLDOWN);
                 DrawCircleV(orbPos, DASH_ORB_SIZE, Fade(SKYBLUE, ratio));
             } else {
                 DrawCircleLinesV(orbPos, DASH_ORB_SIZE, Fade(SKYBLUE, 0.3f));
@@ -1232,28 +1315,28 @@ static void DrawPlayer(void)
     // Sword swing arc
     if (p->sword.timer > 0 && !p->sword.lunge) {
         Color arcColor = p->sword.dashSlash ? SKYBLUE : ORANGE;
-        DrawSwordArc(p->pos, p->sword.timer, p->sword.duration,
-            p->sword.angle, p->sword.arc, p->sword.radius, arcColor);
+        DrawSwordArc(p->pos, p->sword.timer, TUNE(SWORD_DURATION),
+            p->sword.angle, TUNE(SWORD_ARC), TUNE(SWORD_RADIUS), arcColor);
     }
     // Sword lunge thrust
     if (p->sword.timer > 0 && p->sword.lunge) {
         float range = p->sword.dashSlash ?
-            LUNGE_RANGE * LUNGE_DASH_RANGE_MULT : LUNGE_RANGE;
-        float progress = 1.0f - (p->sword.timer / LUNGE_DURATION);
+            TUNE(LUNGE_RANGE) * LUNGE_DASH_RANGE_MULT : TUNE(LUNGE_RANGE);
+        float progress = 1.0f - (p->sword.timer / TUNE(LUNGE_DURATION));
         Vector2 dir = { cosf(p->sword.angle), sinf(p->sword.angle) };
         Vector2 tip = Vector2Add(p->pos, Vector2Scale(dir, range));
         Color lungeColor = p->sword.dashSlash ? SKYBLUE : RED;
 
         // Cone edges
-        Vector2 leftDir = { cosf(p->sword.angle - LUNGE_CONE_HALF),
-                            sinf(p->sword.angle - LUNGE_CONE_HALF) };
-        Vector2 rightDir = { cosf(p->sword.angle + LUNGE_CONE_HALF),
-                             sinf(p->sword.angle + LUNGE_CONE_HALF) };
+        Vector2 leftDir = { cosf(p->sword.angle - TUNE(LUNGE_CONE_HALF)),
+                            sinf(p->sword.angle - TUNE(LUNGE_CONE_HALF)) };
+        Vector2 rightDir = { cosf(p->sword.angle + TUNE(LUNGE_CONE_HALF)),
+                             sinf(p->sword.angle + TUNE(LUNGE_CONE_HALF)) };
         Vector2 leftTip = Vector2Add(p->pos, Vector2Scale(leftDir, range));
         Vector2 rightTip = Vector2Add(p->pos, Vector2Scale(rightDir, range));
 
         // Trailing cone fill
-        float fadeOut = p->sword.timer / LUNGE_DURATION;
+        float fadeOut = p->sword.timer / TUNE(LUNGE_DURATION);
         DrawTriangle(p->pos, leftTip, rightTip, Fade(lungeColor, 0.15f * fadeOut));
 
         // Cone edge lines
@@ -1270,8 +1353,8 @@ static void DrawPlayer(void)
 
     // Spin attack trailing arc
     if (p->spin.timer > 0) {
-        float progress = 1.0f - (p->spin.timer / p->spin.duration);
-        float fadeOut = p->spin.timer / p->spin.duration;
+        float progress = 1.0f - (p->spin.timer / TUNE(SPIN_DURATION));
+        float fadeOut = p->spin.timer / TUNE(SPIN_DURATION);
 
         // 2 full rotations over the spin duration
         float totalSweep = PI * 4.0f;
@@ -1282,7 +1365,7 @@ static void DrawPlayer(void)
         float actualTrail = fminf(trailLength, sweepAngle);
 
         // Trailing arcs (outer YELLOW + inner ORANGE)
-        float innerR = p->spin.radius * SPIN_INNER_RADIUS_FRAC;
+        float innerR = TUNE(SPIN_RADIUS) * SPIN_INNER_RADIUS_FRAC;
         for (int i = 0; i < numSegments; i++) {
             float t = (float)(i + 1) / numSegments;
             float a0 = sweepAngle
@@ -1293,8 +1376,8 @@ static void DrawPlayer(void)
             float c1 = cosf(a1), s1 = sinf(a1);
             // Outer arc
             DrawLineEx(
-                (Vector2){ p->pos.x + c0 * p->spin.radius, p->pos.y + s0 * p->spin.radius },
-                (Vector2){ p->pos.x + c1 * p->spin.radius, p->pos.y + s1 * p->spin.radius },
+                (Vector2){ p->pos.x + c0 * TUNE(SPIN_RADIUS), p->pos.y + s0 * TUNE(SPIN_RADIUS) },
+                (Vector2){ p->pos.x + c1 * TUNE(SPIN_RADIUS), p->pos.y + s1 * TUNE(SPIN_RADIUS) },
                 2.0f + t * 5.0f, Fade(YELLOW, t * t * fadeOut * 0.9f));
             // Inner arc
             DrawLineEx(
@@ -1305,19 +1388,52 @@ static void DrawPlayer(void)
 
         // White leading edge line
         Vector2 sweepEnd = Vector2Add(p->pos,
-            (Vector2){ cosf(sweepAngle) * p->spin.radius,
-                       sinf(sweepAngle) * p->spin.radius });
+            (Vector2){ cosf(sweepAngle) * TUNE(SPIN_RADIUS),
+                       sinf(sweepAngle) * TUNE(SPIN_RADIUS) });
         DrawLineEx(p->pos, sweepEnd, 3.0f, Fade(WHITE, fadeOut));
     }
 }
 
+// particles go out as textured quads in a few big rlBegin batches instead of
+// a triangle fan per DrawCircleV, one baked white circle tinted per vertex
+static Texture2D particleSprite;
+
+static void LoadParticleSprite(void)
+{
+    int s = PARTICLE_SPRITE_SIZE;
+    Image img = GenImageColor(s, s, BLANK);
+    ImageDrawCircle(&img, s / 2, s / 2, s / 2 - 1, WHITE);
+    particleSprite = LoadTextureFromImage(img);
+    UnloadImage(img);
+    SetTextureFilter(particleSprite, TEXTURE_FILTER_BILINEAR);
+}
+
 static void DrawParticles(void)
 {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle *pt = &g.vfx.particles[i];
-        if (!pt->active) continue;
-        float alpha = pt->lifetime / pt->maxLifetime;
-        DrawCircleV(pt->pos, pt->size * alpha, Fade(pt->color, alpha));
+    if (particleSprite.id == 0) LoadParticleSprite();
+    ParticleStore *ps = &g.vfx.particles;
+    int count = g.pool[POOL_PARTICLE].count;
+    for (int start = 0; start < count; start += PARTICLE_DRAW_BATCH) {
+        int end = start + PARTICLE_DRAW_BATCH;
+        if (end > count) end = count;
+        // flush up front if this chunk won't fit, never mid rlBegin
+        rlCheckRenderBatchLimit((end - start) * 4);
+        rlSetTexture(particleSprite.id);
+        rlBegin(RL_QUADS);
+        for (int i = start; i < end; i++) {
+            if (!ps->active[i]) continue;
+            float alpha = ps->lifetime[i] * ps->invLife[i];
+            float r = ps->size[i] * alpha;
+            float x = ps->pos[i].x, y = ps->pos[i].y;
+            Color c = ps->color[i];
+            rlColor4ub(c.r, c.g, c.b, (unsigned char)(c.a * alpha));
+            rlTexCoord2f(0, 0); rlVertex2f(x - r, y - r);
+            rlTexCoord2f(0, 1); rlVertex2f(x - r, y + r);
+            rlTexCoord2f(1, 1); rlVertex2f(x + r, y + r);
+            rlTexCoord2f(1, 0); rlVertex2f(x + r, y - r);
+        }
+        rlEnd();
+        rlSetTexture(0);
     }
 }
 
@@ -1337,8 +1453,8 @@ static void DrawPedestals(void)
 
     // Sword demo arc
     if (g.selectSwordTimer > 0 && g.selectIndex == 0) {
-        DrawSwordArc(pedestals[0], g.selectSwordTimer, SWORD_DURATION,
-            g.selectSwordAngle, SWORD_ARC, SWORD_RADIUS, ORANGE);
+        DrawSwordArc(pedestals[0], g.selectSwordTimer, TUNE(SWORD_DURATION),
+            g.selectSwordAngle, TUNE(SWORD_ARC), TUNE(SWORD_RADIUS), ORANGE);
     }
 
     // Pedestals
@@ -1370,13 +1486,13 @@ static void DrawPedestals(void)
             highlighted ? SHADOW_ALPHA : SHADOW_ALPHA * 0.3f;
         Vector2 shadowP = { pedestals[i].x + SHADOW_OFFSET_X,
                             pedestals[i].y + SHADOW_OFFSET_Y };
-        solidFns[i](pedestals[i], solidSize, t * PLAYER_ROT_SPEED, PLAYER_ROT_TILT,
+        solidFns[i](pedestals[i], solidSize, t * TUNE(PLAYER_ROT_SPEED), PLAYER_ROT_TILT,
             solidAlpha, shadowP, shadowAlpha);
     }
 
     // Player (sphere before pick, solid after)
     {
-        float rotY = t * PLAYER_ROT_SPEED;
+        float rotY = t * TUNE(PLAYER_ROT_SPEED);
         float rotX = PLAYER_ROT_TILT;
         Vector2 shadowPos = { p->shadowPos.x + SHADOW_OFFSET_X,
                               p->shadowPos.y + SHADOW_OFFSET_Y };
@@ -1843,12 +1959,12 @@ static void DrawCooldownColumn(Player *p, float ui)
     int labelY = barY - (int)(HUD_CD_LABEL_GAP * ui) - cdFont;
 
     // Compute total width for centering
-    int shtgnW = SHOTGUN_BLASTS * pipW
-        + (SHOTGUN_BLASTS - 1) * pipGap;
+    int shtgnW = TUNE(SHOTGUN_BLASTS) * pipW
+        + (TUNE(SHOTGUN_BLASTS) - 1) * pipGap;
     int nBarSlots = 12;
 #if 0 // dash pips — replaced by diegetic orbs
-    int dashW = p->dash.maxCharges * pipW
-        + (p->dash.maxCharges - 1) * pipGap;
+    int dashW = TUNE(DASH_MAX_CHARGES) * pipW
+        + (TUNE(DASH_MAX_CHARGES) - 1) * pipGap;
     int totalW = dashW + shtgnW + nBarSlots * cdBarW
         + (nBarSlots + 1) * colGap;
 #else
@@ -1859,12 +1975,12 @@ static void DrawCooldownColumn(Player *p, float ui)
 
 #if 0 // dash pips — replaced by diegetic orbs
     {
-        bool recharging = p->dash.charges < p->dash.maxCharges;
+        bool recharging = p->dash.charges < TUNE(DASH_MAX_CHARGES);
         float rechargeRatio = recharging
-            ? 1.0f - (p->dash.rechargeTimer / p->dash.rechargeTime)
+            ? 1.0f - (p->dash.rechargeTimer / TUNE(DASH_COOLDOWN))
             : 0;
         DrawPipBar(cdX, barY, pipW, cdBarH, pipGap,
-            p->dash.maxCharges, p->dash.charges,
+            TUNE(DASH_MAX_CHARGES), p->dash.charges,
             recharging, rechargeRatio,
             SKYBLUE, "DASH", labelY, cdFont);
         cdX += dashW + colGap;
@@ -1878,7 +1994,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_BFG);
     bool locked = !IsOwned(p, ABL_BFG);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : (p->bfg.active ? 0 : p->bfg.charge / BFG_CHARGE_COST),
+        locked ? 0 : (p->bfg.active ? 0 : p->bfg.charge / TUNE(BFG_CHARGE_COST)),
         locked ? DARKGRAY : BFG_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1888,10 +2004,10 @@ static void DrawCooldownColumn(Player *p, float ui)
         bool recharging = !locked && p->shotgun.blastsLeft == 0
             && p->shotgun.cooldownTimer > 0;
         float rechargeRatio = recharging
-            ? 1.0f - (p->shotgun.cooldownTimer / SHOTGUN_COOLDOWN)
+            ? 1.0f - (p->shotgun.cooldownTimer / TUNE(SHOTGUN_COOLDOWN))
             : 0;
         DrawPipBar(cdX, barY, pipW, cdBarH, pipGap,
-            SHOTGUN_BLASTS, locked ? 0 : p->shotgun.blastsLeft,
+            TUNE(SHOTGUN_BLASTS), locked ? 0 : p->shotgun.blastsLeft,
             recharging, rechargeRatio,
             locked ? DARKGRAY : ORANGE, ci.label, labelY, cdFont, ci.isModified);
         cdX += shtgnW + colGap;
@@ -1901,7 +2017,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_RAILGUN);
     bool locked = !IsOwned(p, ABL_RAILGUN);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->railgun.cooldownTimer / RAILGUN_COOLDOWN,
+        locked ? 0 : 1.0f - p->railgun.cooldownTimer / TUNE(RAILGUN_COOLDOWN),
         locked ? DARKGRAY : RAILGUN_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1909,7 +2025,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_SPIN);
     bool locked = !IsOwned(p, ABL_SPIN);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->spin.cooldownTimer / SPIN_COOLDOWN,
+        locked ? 0 : 1.0f - p->spin.cooldownTimer / TUNE(SPIN_COOLDOWN),
         locked ? DARKGRAY : YELLOW, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1923,7 +2039,7 @@ static void DrawCooldownColumn(Player *p, float ui)
             ratio = 1.0f; color = WHITE;
         } else if (p->parry.cooldownTimer > 0) {
             float maxCd = p->parry.succeeded
-                ? PARRY_SUCCESS_COOLDOWN : PARRY_COOLDOWN;
+                ? TUNE(PARRY_SUCCESS_COOLDOWN) : TUNE(PARRY_COOLDOWN);
             ratio = 1.0f - (p->parry.cooldownTimer / maxCd);
             color = PARRY_COLOR;
         } else {
@@ -1938,7 +2054,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_HEAL);
     bool locked = !IsOwned(p, ABL_HEAL);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->healCooldown / HEAL_COOLDOWN,
+        locked ? 0 : 1.0f - p->healCooldown / TUNE(HEAL_COOLDOWN),
         locked ? DARKGRAY : HEAL_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1949,10 +2065,10 @@ static void DrawCooldownColumn(Player *p, float ui)
         if (locked) {
             ratio = 0; color = DARKGRAY;
         } else if (p->shield.regenTimer < 0) {
-            ratio = 1.0f + p->shield.regenTimer / SHIELD_BROKEN_COOLDOWN;
+            ratio = 1.0f + p->shield.regenTimer / TUNE(SHIELD_BROKEN_COOLDOWN);
             color = RED;
         } else {
-            ratio = p->shield.hp / p->shield.maxHp;
+            ratio = p->shield.hp / TUNE(SHIELD_MAX_HP);
             color = (Color)SHIELD_COLOR;
         }
         DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
@@ -1964,7 +2080,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_GRENADE);
     bool locked = !IsOwned(p, ABL_GRENADE);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->grenade.cooldownTimer / GRENADE_COOLDOWN,
+        locked ? 0 : 1.0f - p->grenade.cooldownTimer / TUNE(GRENADE_COOLDOWN),
         locked ? DARKGRAY : GRENADE_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1972,7 +2088,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_FIRE);
     bool locked = !IsOwned(p, ABL_FIRE);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : p->flame.fuel / FLAME_FUEL_MAX,
+        locked ? 0 : p->flame.fuel / TUNE(FLAME_FUEL_MAX),
         locked ? DARKGRAY : FLAME_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1980,7 +2096,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_SLAM);
     bool locked = !IsOwned(p, ABL_SLAM);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->slam.cooldownTimer / SLAM_COOLDOWN,
+        locked ? 0 : 1.0f - p->slam.cooldownTimer / TUNE(SLAM_COOLDOWN),
         locked ? DARKGRAY : SLAM_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1989,7 +2105,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     bool locked = !IsOwned(p, ABL_BLINK);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
         locked ? 0 : (p->blink.cooldown > 0
-            ? 1.0f - p->blink.cooldown / BLINK_COOLDOWN : 1.0f),
+            ? 1.0f - p->blink.cooldown / TUNE(BLINK_COOLDOWN) : 1.0f),
         locked ? DARKGRAY : BLINK_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -1997,7 +2113,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_TURRET);
     bool locked = !IsOwned(p, ABL_TURRET);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->turretCooldown / TURRET_COOLDOWN,
+        locked ? 0 : 1.0f - p->turretCooldown / TUNE(TURRET_COOLDOWN),
         locked ? DARKGRAY : TURRET_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -2005,7 +2121,7 @@ static void DrawCooldownColumn(Player *p, float ui)
     { CdBarInfo ci = CD(ABL_MINE);
     bool locked = !IsOwned(p, ABL_MINE);
     DrawCooldownBar(cdX, barY, cdBarW, cdBarH,
-        locked ? 0 : 1.0f - p->mineCooldown / MINE_COOLDOWN,
+        locked ? 0 : 1.0f - p->mineCooldown / TUNE(MINE_COOLDOWN),
         locked ? DARKGRAY : MINE_COLOR, ci.label, labelY, cdFont, ci.isModified);
     cdX += cdBarW + colGap; }
 
@@ -2043,10 +2159,10 @@ static void DrawWeaponStatus(Player *p, float ui)
         Color bonusColor = GOLD;
         float segGap = HUD_ARC_SEG_GAP;
         float segAngle = (arcSpan
-            - (REVOLVER_ROUNDS - 1) * segGap) / REVOLVER_ROUNDS;
+            - (TUNE(REVOLVER_ROUNDS) - 1) * segGap) / TUNE(REVOLVER_ROUNDS);
 
         // 6 round segments
-        for (int i = 0; i < REVOLVER_ROUNDS; i++) {
+        for (int i = 0; i < TUNE(REVOLVER_ROUNDS); i++) {
             float sEnd = arcEnd - i * (segAngle + segGap);
             float sStart = sEnd - segAngle;
             bool loaded = i < p->revolver.rounds;
@@ -2077,19 +2193,19 @@ static void DrawWeaponStatus(Player *p, float ui)
         if (p->revolver.reloadTimer > 0) {
             float ratio = 1.0f
                 - (p->revolver.reloadTimer
-                    / REVOLVER_RELOAD_TIME);
+                    / TUNE(REVOLVER_RELOAD_TIME));
             if (ratio > 1.0f) ratio = 1.0f;
             if (ratio < 0.0f) ratio = 0.0f;
 
             // Sweet spot zone
             float sweetSA = arcEnd
-                - REVOLVER_RELOAD_SWEET_END * arcSpan;
+                - TUNE(REVOLVER_RELOAD_SWEET_END) * arcSpan;
             float sweetEA = arcEnd
-                - REVOLVER_RELOAD_SWEET_START * arcSpan;
+                - TUNE(REVOLVER_RELOAD_SWEET_START) * arcSpan;
             Color sweetColor;
             if (p->revolver.reloadLocked) {
                 bool hit = p->revolver.reloadTimer
-                    <= REVOLVER_RELOAD_FAST_TIME + 0.01f;
+                    <= TUNE(REVOLVER_RELOAD_FAST_TIME) + 0.01f;
                 sweetColor = hit
                     ? RELOAD_HIT_COLOR
                     : RELOAD_MISS_COLOR;
@@ -2359,13 +2475,13 @@ static void DrawHUD(void)
     int hpBarH = (int)(HUD_HP_H * ui);
     int hpBarX = (int)(HUD_MARGIN * ui);
     int hpBarY = (int)(HUD_MARGIN * ui);
-    float hpRatio = (float)p->hp / p->maxHp;
+    float hpRatio = (float)p->hp / TUNE(PLAYER_HP);
     DrawRectangle(hpBarX, hpBarY, hpBarW, hpBarH, DARKGRAY);
     Color hpColor = (hpRatio > 0.5f) ? GREEN : (hpRatio > 0.25f) ? ORANGE : RED;
     DrawRectangle(hpBarX, hpBarY, (int)(hpBarW * hpRatio), hpBarH, hpColor);
     DrawRectangleLines(hpBarX, hpBarY, hpBarW, hpBarH, WHITE);
     DrawText(
-        TextFormat("HP: %d/%d", (int)p->hp, (int)p->maxHp),
+        TextFormat("HP: %d/%d", (int)p->hp, TUNE(PLAYER_HP)),
         hpBarX + (int)(HUD_HP_TEXT_PAD_X * ui), hpBarY + (int)(HUD_HP_TEXT_PAD_Y * ui), (int)(HUD_HP_FONT * ui), WHITE);
 
     // Score
@@ -2454,6 +2570,54 @@ static void DrawHUD(void)
     if (g.gameOver) DrawGameOver(sw, sh, ui);
 }
 
+// F3 overlay preview of a packed texture, registered for hot reload so
+// saving yoda.jpg under asset_blob/assets shows up here on the next frame
+static Texture2D statsAsset;
+static bool statsAssetLoaded;
+
+static void DrawStatsAsset(int x, int y, float ui)
+{
+    if (!statsAssetLoaded) {
+        statsAsset = LoadAssetTexture(ASSET_ID_YODA_JPG);
+        WatchAssetTexture(ASSET_ID_YODA_JPG, &statsAsset);
+        statsAssetLoaded = true;
+    }
+    if (!statsAsset.id) return;
+    // reread every frame, a reload can change the size
+    float side = HUD_STATS_ASSET * ui;
+    float scale = side / (float)(statsAsset.width > statsAsset.height
+        ? statsAsset.width : statsAsset.height);
+    DrawTextureEx(statsAsset, (Vector2){ (float)x, (float)y }, 0, scale, WHITE);
+}
+
+// F3 overlay, pool occupancy and growth/drop telemetry
+static void DrawStats(float ui)
+{
+    int font = (int)(HUD_STATS_FONT * ui);
+    int line = (int)(HUD_STATS_LINE * ui);
+    int x = (int)(HUD_MARGIN * ui);
+    int y = (int)(HUD_STATS_Y * ui);
+    DrawRectangle(x - 4, y - 4, (int)(HUD_STATS_W * ui),
+        line * (POOL_COUNT + 3) + 8, HUD_STATS_BG);
+    DrawText("pool        count   cap   max  peak moved drops recyc",
+        x, y, font, GRAY);
+    for (int i = 0; i < POOL_COUNT; i++) {
+        PoolInfo *p = &g.pool[i];
+        y += line;
+        DrawText(TextFormat("%-11s %5d %5d %5d %5d %5d %5u %5u",
+            PoolName((PoolID)i), p->count, p->cap, p->max, p->peak,
+            p->moved, p->drops, p->recycled),
+            x, y, font, p->drops ? RED : (p->cap > p->max / 2) ? YELLOW : GREEN);
+    }
+    y += line;
+    DrawText(TextFormat("step %5.2f ms", (double)g.stepMs),
+        x, y, font, GREEN);
+    y += line;
+    DrawText(TextFormat("snapshot %7d KiB %7.0f B/tick delta",
+        g.snapBytes / 1024, (double)g.snapDelta), x, y, font, GREEN);
+    DrawStatsAsset(x - 4, y + line + 8, ui);
+}
+
 // Draw - orchestrator
 static void DrawGame(void)
 {
@@ -2465,6 +2629,7 @@ static void DrawGame(void)
     EndMode2D();
 
     DrawHUD();
+    if (g.showStats) DrawStats((float)GetScreenHeight() / HUD_SCALE_REF);
     DrawTransition();
 
     EndDrawing();
@@ -0,0 +1,175 @@
+// flow.c
+// shared flow field toward the player shadow, one BFS for every chaser
+// instead of every enemy steering on its own
+#include "game.h"
+
+// the field covers the whole play area (combat zone, corridor, base) so
+// walls shape the paths, enemies themselves stay clamped to the combat zone
+// sized from default.h. the extents are floats, which a #define can't turn
+// into an array size, an enum folds them to integer constants (gcc, clang)
+enum {
+    FLOW_COLS  = (int)(MAP_RIGHT / FLOW_CELL) + 1,     // x = MAP_RIGHT included
+    FLOW_ROWS  = (int)(BASE_BOTTOM / FLOW_CELL)         // rounded up
+        + ((int)(BASE_BOTTOM / FLOW_CELL) * FLOW_CELL < BASE_BOTTOM),
+    FLOW_CELLS = FLOW_COLS * FLOW_ROWS,
+};
+#define FLOW_UNSEEN 0xffff
+
+static struct {
+    u16 dist[FLOW_CELLS];       // chamfer distance to target, 10 per cell
+    Vector2 dir[FLOW_CELLS];    // unit direction downhill, zero = none
+    bool walkable[FLOW_CELLS];
+    int target;                 // cell the field was built for, -1 = stale
+    bool ready;
+} flow = { .target = -1 };
+
+// same shape ClampToPlayArea enforces for the player
+static bool InPlayArea(float x, float y)
+{
+    if (y < 0 || y > BASE_BOTTOM) return false;
+    if (y <= STEP_Y) return x >= MAP_LEFT && x <= MAP_RIGHT;
+    if (y <= MAP_SIZE) return x >= 0 && x <= MAP_RIGHT;
+    return x >= 0 && x <= BASE_W;
+}
+
+static int FlowCell(Vector2 pos)
+{
+    int cx = (int)(pos.x / FLOW_CELL);
+    int cy = (int)(pos.y / FLOW_CELL);
+    if (cx < 0) cx = 0;
+    if (cx >= FLOW_COLS) cx = FLOW_COLS - 1;
+    if (cy < 0) cy = 0;
+    if (cy >= FLOW_ROWS) cy = FLOW_ROWS - 1;
+    return cy * FLOW_COLS + cx;
+}
+
+// obstacles go here once the map has any, for now it's just the room shape
+static void BuildWalkable(void)
+{
+    for (int cy = 0; cy < FLOW_ROWS; cy++)
+        for (int cx = 0; cx < FLOW_COLS; cx++)
+            flow.walkable[cy * FLOW_COLS + cx] = InPlayArea(
+                (cx + 0.5f) * FLOW_CELL, (cy + 0.5f) * FLOW_CELL);
+    flow.ready = true;
+}
+
+static const int NX[8] = { 1, -1, 0,  0, 1,  1, -1, -1 };
+static const int NY[8] = { 0,  0, 1, -1, 1, -1,  1, -1 };
+static const u16 NCOST[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+static u16 DistOr(int cx, int cy, u16 fallback)
+{
+    if (cx < 0 || cy < 0 || cx >= FLOW_COLS || cy >= FLOW_ROWS)
+        return fallback;
+    u16 d = flow.dist[cy * FLOW_COLS + cx];
+    return (d == FLOW_UNSEEN) ? fallback : d;
+}
+
+// label-correcting BFS with 10/14 step costs, a cell can be re-queued when
+// a cheaper diagonal route shows up, each cell is in the queue at most once
+static void BuildField(int target)
+{
+    static int queue[FLOW_CELLS];
+    static bool queued[FLOW_CELLS];
+    memset(flow.dist, 0xff, sizeof(flow.dist));
+    memset(queued, 0, sizeof(queued));
+
+    int head = 0, size = 0;
+    flow.dist[target] = 0;
+    queue[0] = target;
+    queued[target] = true;
+    size = 1;
+    while (size > 0) {
+        int c = queue[head];
+        head = (head + 1) % FLOW_CELLS;
+        size--;
+        queued[c] = false;
+        int cx = c % FLOW_COLS, cy = c / FLOW_COLS;
+        for (int k = 0; k < 8; k++) {
+            int nx = cx + NX[k], ny = cy + NY[k];
+            if (nx < 0 || ny < 0 || nx >= FLOW_COLS || ny >= FLOW_ROWS)
+                continue;
+            int n = ny * FLOW_COLS + nx;
+            if (!flow.walkable[n]) continue;
+            // no corner cutting past a wall on diagonals
+            if (k >= 4 && (!flow.walkable[cy * FLOW_COLS + nx]
+                        || !flow.walkable[ny * FLOW_COLS + cx])) continue;
+            u16 d = (u16)(flow.dist[c] + NCOST[k]);
+            if (d >= flow.dist[n]) continue;
+            flow.dist[n] = d;
+            if (!queued[n]) {
+                queue[(head + size) % FLOW_CELLS] = n;
+                queued[n] = true;
+                size++;
+            }
+        }
+    }
+
+    // central difference of the distance field, smoother than snapping to
+    // one of 8 neighbours. walls and unreached cells read as flat
+    for (int c = 0; c < FLOW_CELLS; c++) {
+        flow.dir[c] = (Vector2){ 0, 0 };
+        u16 self = flow.dist[c];
+        if (self == FLOW_UNSEEN || self == 0) continue;
+        int cx = c % FLOW_COLS, cy = c / FLOW_COLS;
+        float gx = (float)DistOr(cx - 1, cy, self) - DistOr(cx + 1, cy, self);
+        float gy = (float)DistOr(cx, cy - 1, self) - DistOr(cx, cy + 1, self);
+        float len = sqrtf(gx * gx + gy * gy);
+        if (len > 0.0f) {
+            flow.dir[c] = (Vector2){ gx / len, gy / len };
+            continue;
+        }
+        // ridge (equal both ways), step to the cheapest neighbour instead
+        u16 best = self;
+        for (int k = 0; k < 8; k++) {
+            u16 d = DistOr(cx + NX[k], cy + NY[k], FLOW_UNSEEN);
+            if (d < best) {
+                best = d;
+                flow.dir[c] = Vector2Normalize(
+                    (Vector2){ (float)NX[k], (float)NY[k] });
+            }
+        }
+    }
+    flow.target = target;
+}
+
+// rebuilds only when the target crosses into a new cell, and then the whole
+// field. repairing from the old one saves little, the cells nearer the new
+// target (about half) would still relax and the gradient pass touches every
+// cell anyway. a full build is ~50 us at -O2, at most one per tick and a few
+// a second at walking speed
+void UpdateFlowField(Vector2 target)
+{
+    if (!flow.ready) BuildWalkable();
+    int cell = FlowCell(target);
+    if (!flow.walkable[cell]) return;   // keep the last good field
+    if (cell != flow.target) BuildField(cell);
+}
+
+// O(1) sample, false when there's no useful direction here (target cell,
+// unreachable, field not built), the caller steers straight at the target
+bool FlowDirection(Vector2 pos, Vector2 *dir)
+{
+    if (flow.target < 0) return false;
+    Vector2 d = flow.dir[FlowCell(pos)];
+    if (d.x == 0 && d.y == 0) return false;
+    *dir = d;
+    return true;
+}
+
+// the cache lives outside g, so a second sim instance has to carry its own.
+// lockstep restores one per image around each Step
+size_t FlowFieldBytes(void)
+{
+    return sizeof(flow);
+}
+
+void CaptureFlowField(void *out)
+{
+    memcpy(out, &flow, sizeof(flow));
+}
+
+void RestoreFlowField(const void *in)
+{
+    memcpy(&flow, in, sizeof(flow));
+}
@@ -4,6 +4,7 @@
 #define GAME_H
 
 #include "mecha.h"
+#include "asset_ids.h"
 
 // Shared State
 extern GameState g;
@@ -13,6 +14,24 @@ void InitGame(void);
 void InitPlayer(void);
 void ClearPools(void);
 
+// pool.c
+void PoolDefaultConfig(PoolConfig *cfg);
+void PoolConfigFromArgs(PoolConfig *cfg, int argc, char **argv);
+void InitPools(const PoolConfig *cfg);
+void ResetPools(void);
+int ClaimSlot(PoolID id);
+int ClaimSlots(PoolID id, int n, int *out);
+int ClaimRingSlot(PoolID id);
+void TrimPools(void);
+void CompactPools(void);
+void ReorderEnemies(const int *order, int n);
+const char *PoolName(PoolID id);
+Handle DeployableHandle(int idx);
+Deployable *GetDeployable(Handle h);
+size_t PoolSnapshotBytes(void);
+size_t SavePools(u8 *out);
+void LoadPools(const u8 *in);
+
 // spawn.c
 extern const EnemyDef ENEMY_DEFS[];
 Projectile* SpawnProjectile(
@@ -20,11 +39,18 @@ Projectile* SpawnProjectile(
     float speed, int damage, float lifetime, float size,
     bool isEnemy, bool knockback,
     ProjectileType type, DamageType dmgType);
+void InitPatterns(void);
+int EmitPattern(PatternID id, Vector2 origin, Vector2 aim, float muzzle);
 void FireShotgunBlast(Player *p, Vector2 toMouse);
 void SpawnRocket(Player *p, Vector2 toMouse);
 void SpawnGrenade(Player *p, Vector2 toMouse);
 void SpawnPod(int podValue);
 void SpawnBoss(EnemyType type);
+void QueueEnemyShot(int enemy, Vector2 toTarget, float dist, float dt);
+void FireEnemyShots(void);
+void GovernParticles(float frameTime);
+int VfxRandom(int min, int max);
+int SimRandom(int min, int max);
 void SpawnParticle(
     Vector2 pos, Vector2 vel,
     Color color, float size, float lifetime);
@@ -39,8 +65,70 @@ float EnemyAngle(Enemy *e);
 bool EnemyHitSweep(Enemy *e, Vector2 a, Vector2 b, float pad);
 bool EnemyHitPoint(Enemy *e, Vector2 point, float pad);
 bool EnemyHitCircle(Enemy *e, Vector2 center, float radius);
+ArcSector MakeArc(Vector2 origin, float angle, float halfArc, float radius);
+ArcSector MakeArcBetween(Vector2 origin, float from, float to, float radius);
+bool InArc(const ArcSector *arc, Vector2 point, float pad);
+void BuildEnemyGrid(void);
+void SortEnemiesSpatial(void);
+int QueryEnemies(Vector2 center, float radius, int *out, int maxOut);
+void SeparateEnemies(void);
+
+// blob.c
+bool LoadAssetBlob(const char *path);
+void UnloadAssetBlob(void);
+int FindAsset(const char *name);
+int FindAssetHash(u32 hash);
+const u8 *AssetData(int idx, int *len);
+const char *AssetName(int idx);
+Texture2D LoadAssetTexture(u32 id);
+Font LoadAssetFont(u32 id, int fontSize);
+Wave LoadAssetWave(u32 id);
+Music LoadAssetMusic(u32 id);
+void PatchAsset(int idx, u8 *data, int len);
+
+// watch.c
+void InitAssetWatch(const char *dir);
+void CloseAssetWatch(void);
+void WatchAssetTexture(u32 id, Texture2D *tex);
+void PollAssetWatch(void);
+
+// tuning.c
+bool LoadTuning(const char *path);
+bool SaveTuning(const char *path);
+bool SaveTuningText(const char *path);
+void PollTuning(void);
+
+// snapshot.c
+void InitSnapshots(void);
+size_t SnapshotBytes(void);
+size_t CaptureSnapshot(u8 *out);
+void RestoreSnapshotImage(const u8 *image);
+bool SaveSnapshot(void);
+bool RestoreSnapshot(u32 tick);
+bool RestoreLatestSnapshot(void);
+size_t SnapshotDeltaBound(void);
+size_t EncodeSnapshotDelta(const u8 *base, size_t baseBytes,
+    const u8 *cur, size_t curBytes, u8 *out);
+size_t DecodeSnapshotDelta(const u8 *base, size_t baseBytes,
+    const u8 *delta, size_t deltaBytes, u8 *out);
+void MeasureSnapshotDelta(void);
+
+// flow.c
+void UpdateFlowField(Vector2 target);
+bool FlowDirection(Vector2 pos, Vector2 *dir);
+size_t FlowFieldBytes(void);
+void CaptureFlowField(void *out);
+void RestoreFlowField(const void *in);
+
+// input.c
+void DetectInputMode(void);
+void ReadInput(InputFrame *in, float frameTime);
+
+// lockstep.c
+bool RunLockstep(const PoolConfig *pools, int ticks);
 
 // update.c
+void Step(const InputFrame *in);
 void UpdateGame(void);
 
 // draw.c
@@ -9,7 +9,12 @@ GameState g;
 // this is quite important.
 void InitGame(void)
 {
+    // the sim rng carries over a restart, the host seeds it once at startup
+    u32 rng = g.rng;
     memset(&g, 0, sizeof(g));
+    g.rng = rng ? rng : SIM_RNG_SEED;
+    // pools live in the arena, not in g, wipe them and rebind the pointers
+    ResetPools();
     
     // must be called after memory is set
     InitPlayer();
@@ -17,9 +22,9 @@ void InitGame(void)
     g.camera.offset   = (Vector2){ SCREEN_W / 2.0f, SCREEN_H / 2.0f };
     g.camera.target   = (Vector2){ BASE_CENTER_X, BASE_CENTER_Y };  // base room center
     g.camera.zoom     = 1.0f;
+    g.vfx.particleScale = 1.0f;
 
-    g.spawnInterval   = SPAWN_INTERVAL;
-    g.spawnTimer      = SPAWN_INITIAL_DELAY;
+    g.spawnTimer      = TUNE(SPAWN_INITIAL_DELAY);
     g.podValue        = POD_VALUE_INITIAL;
 
     g.phase           = PHASE_SELECT;
@@ -59,29 +64,14 @@ void InitPlayer(void)
 {
     Player *p  = &g.player;
     p->pos     = (Vector2){ MAP_LEFT + MAP_SIZE / 2.0f, MAP_SIZE / 2.0f };
-    p->speed   = PLAYER_SPEED;
     p->size    = PLAYER_SIZE;
-    p->hp      = PLAYER_HP;
-    p->maxHp   = PLAYER_HP;
+    p->hp      = TUNE(PLAYER_HP);
 
-    p->gun.fireRate         = GUN_FIRE_RATE;
-    p->sword.duration       = SWORD_DURATION;
-    p->sword.arc            = SWORD_ARC;
-    p->sword.radius         = SWORD_RADIUS;
-    p->dash.speed           = DASH_SPEED;
-    p->dash.duration        = DASH_DURATION;
-    p->dash.rechargeTime    = DASH_COOLDOWN;
-    p->dash.charges         = DASH_MAX_CHARGES;
-    p->dash.maxCharges      = DASH_MAX_CHARGES;
-    p->spin.duration        = SPIN_DURATION;
-    p->spin.radius          = SPIN_RADIUS;
-    p->spin.cooldown        = SPIN_COOLDOWN;
-    p->rocket.cooldown      = ROCKET_COOLDOWN;
-    p->shotgun.blastsLeft   = SHOTGUN_BLASTS;
-    p->revolver.rounds      = REVOLVER_ROUNDS;
-    p->shield.hp            = SHIELD_MAX_HP;
-    p->shield.maxHp         = SHIELD_MAX_HP;
-    p->flame.fuel           = FLAME_FUEL_MAX;
+    p->dash.charges         = TUNE(DASH_MAX_CHARGES);
+    p->shotgun.blastsLeft   = TUNE(SHOTGUN_BLASTS);
+    p->revolver.rounds      = TUNE(REVOLVER_ROUNDS);
+    p->shield.hp            = TUNE(SHIELD_MAX_HP);
+    p->flame.fuel           = TUNE(FLAME_FUEL_MAX);
 
     // ability slots — default layout (all unowned, purchased at shop)
     p->slots[0]  = (AbilitySlot){ ABL_BFG,      KEY_R,          false };
@@ -107,17 +97,22 @@ void InitPlayer(void)
 // setting .active = false is fine because the arrays are already allocated
 void ClearPools(void)
 {
-    for (int i = 0; i < MAX_PARTICLES; i++)
-        g.vfx.particles[i].active = false;
-    for (int i = 0; i < MAX_PROJECTILES; i++)
-        g.projectiles[i].active = false;
+    for (int i = 0; i < g.pool[POOL_PARTICLE].count; i++)
+        g.vfx.particles.active[i] = false;
+    for (int i = 0; i < g.pool[POOL_PLAYER_SHOT].count; i++)
+        g.playerShots[i].active = false;
+    for (int i = 0; i < g.pool[POOL_ENEMY_SHOT].count; i++)
+        g.enemyShots[i].active = false;
     for (int i = 0; i < MAX_BEAMS; i++)
         g.vfx.beams[i].active = false;
     for (int i = 0; i < MAX_VFX_TIMERS; i++)
         g.vfx.timers[i].active = false;
-    for (int i = 0; i < MAX_DEPLOYABLES; i++)
+    for (int i = 0; i < g.pool[POOL_DEPLOYABLE].count; i++)
         g.deployables[i].active = false;
-    for (int i = 0; i < MAX_ENEMIES; i++)
+    for (int i = 0; i < g.pool[POOL_ENEMY].count; i++)
         g.enemies[i].active = false;
     g.lightning.active = false;
+    // everything is inactive now so the scan bounds can start over
+    for (int i = 0; i < POOL_COUNT; i++)
+        g.pool[i].count = 0;
 }
@@ -0,0 +1,160 @@
+// input.c
+// samples raylib once a frame into an InputFrame, the only thing Step reads
+// from the outside world. keyboard, mouse and gamepad all fold into the
+// same buttons, axes and ability bits here, so the sim never asks which
+#include "game.h"
+
+// keyboard aim state, lives with the input because that's what it is
+static Vector2 lastKbAim = { 1, 0 };
+static bool kbAimActive = false;
+static float aimGrace[4] = { 0 }; // right, left, down, up
+
+// Input mode detection — sets g.gamepadActive for HUD display
+void DetectInputMode(void)
+{
+    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
+        for (int b = 1; b <= GAMEPAD_BUTTON_RIGHT_THUMB; b++) {
+            if (IsGamepadButtonPressed(GAMEPAD_INDEX, b)) {
+                g.gamepadActive = true;
+                return;
+            }
+        }
+        float lx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_X);
+        float ly = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_Y);
+        float rx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_X);
+        float ry = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_Y);
+        if (fabsf(lx) > GAMEPAD_STICK_DEADZONE || fabsf(ly) > GAMEPAD_STICK_DEADZONE ||
+            fabsf(rx) > GAMEPAD_STICK_DEADZONE || fabsf(ry) > GAMEPAD_STICK_DEADZONE) {
+            g.gamepadActive = true;
+            return;
+        }
+    }
+    Vector2 md = GetMouseDelta();
+    if (md.x != 0 || md.y != 0) { g.gamepadActive = false; return; }
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
+        g.gamepadActive = false; return;
+    }
+    if (GetKeyPressed() != 0) { g.gamepadActive = false; }
+}
+
+// player -> aim point in world units. keyboard/stick aim is a fixed
+// distance out, a diagonal survives letting go of one key for
+// AIM_KEY_GRACE, and moving the mouse hands aim back to the cursor
+static Vector2 ReadAim(float frameTime)
+{
+    // Right stick aim (gamepad)
+    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
+        float rx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_X) * GAMEPAD_AIM_SENS;
+        float ry = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_Y) * GAMEPAD_AIM_SENS;
+        if (fabsf(rx) > GAMEPAD_STICK_DEADZONE || fabsf(ry) > GAMEPAD_STICK_DEADZONE) {
+            lastKbAim = Vector2Normalize((Vector2){ rx, ry });
+            kbAimActive = true;
+        }
+    }
+
+    // Keyboard aim with grace period for diagonals
+    bool held[4] = {
+        IsKeyDown(KEY_RIGHT) || IsKeyDown(AIM_RIGHT_KEY),
+        IsKeyDown(KEY_LEFT)  || IsKeyDown(AIM_LEFT_KEY),
+        IsKeyDown(KEY_DOWN)  || IsKeyDown(AIM_DOWN_KEY),
+        IsKeyDown(KEY_UP)    || IsKeyDown(AIM_UP_KEY),
+    };
+    for (int i = 0; i < 4; i++) {
+        if (held[i]) aimGrace[i] = AIM_KEY_GRACE;
+        else         aimGrace[i] -= frameTime;
+    }
+    bool anyHeld = held[0] || held[1] || held[2] || held[3];
+    Vector2 arrowDir = { 0, 0 };
+    if (anyHeld) {
+        if (held[0] || aimGrace[0] > 0) arrowDir.x += 1;
+        if (held[1] || aimGrace[1] > 0) arrowDir.x -= 1;
+        if (held[2] || aimGrace[2] > 0) arrowDir.y += 1;
+        if (held[3] || aimGrace[3] > 0) arrowDir.y -= 1;
+    }
+    float arrowLen = Vector2Length(arrowDir);
+    if (arrowLen > 0) {
+        arrowDir = Vector2Scale(arrowDir, 1.0f / arrowLen);
+        lastKbAim = arrowDir;
+        kbAimActive = true;
+    }
+    // Mouse movement disengages keyboard/stick aim
+    Vector2 mouseDelta = GetMouseDelta();
+    if (mouseDelta.x != 0 || mouseDelta.y != 0) kbAimActive = false;
+    if (kbAimActive) return Vector2Scale(lastKbAim, GAMEPAD_AIM_DIST);
+    Vector2 worldMouse = GetScreenToWorld2D(GetMousePosition(), g.camera);
+    return Vector2Subtract(worldMouse, g.player.pos);
+}
+
+// WASD + left stick, length capped at 1
+static Vector2 ReadMove(void)
+{
+    Vector2 moveDir = { 0, 0 };
+    if (IsKeyDown(KEY_W)) moveDir.y -= 1;
+    if (IsKeyDown(KEY_S)) moveDir.y += 1;
+    if (IsKeyDown(KEY_A)) moveDir.x -= 1;
+    if (IsKeyDown(KEY_D)) moveDir.x += 1;
+    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
+        float lx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_X);
+        float ly = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_Y);
+        if (fabsf(lx) > GAMEPAD_STICK_DEADZONE) moveDir.x += lx;
+        if (fabsf(ly) > GAMEPAD_STICK_DEADZONE) moveDir.y += ly;
+    }
+    float moveLen = Vector2Length(moveDir);
+    if (moveLen > 1.0f) moveDir = Vector2Scale(moveDir, 1.0f / moveLen);
+    return moveDir;
+}
+
+// owned slots by their key, then the pad map (LB picks the second layer)
+static void ReadAbilities(InputFrame *in)
+{
+    const Player *p = &g.player;
+    for (int i = 0; i < ABILITY_SLOTS; i++) {
+        if (!p->slots[i].owned) continue;
+        u32 bit = 1u << p->slots[i].ability;
+        if (IsKeyPressed(p->slots[i].key)) in->abilityPressed |= bit;
+        if (IsKeyDown(p->slots[i].key)) in->abilityDown |= bit;
+    }
+    if (!IsGamepadAvailable(GAMEPAD_INDEX)) return;
+    bool lbHeld = IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_1);
+    for (int i = 0; i < (int)PAD_ABILITY_COUNT; i++) {
+        if (PAD_ABILITY_MAP[i].needsLB != lbHeld) continue;
+        u32 bit = 1u << PAD_ABILITY_MAP[i].ability;
+        int button = PAD_ABILITY_MAP[i].button;
+        if (IsGamepadButtonPressed(GAMEPAD_INDEX, button)) in->abilityPressed |= bit;
+        if (IsGamepadButtonDown(GAMEPAD_INDEX, button)) in->abilityDown |= bit;
+    }
+}
+
+// frameTime is the raw one, in->dt gets the DT_MAX clamp
+void ReadInput(InputFrame *in, float frameTime)
+{
+    *in = (InputFrame){ 0 };
+    in->dt = frameTime > DT_MAX ? DT_MAX : frameTime;
+    in->move = ReadMove();
+    in->aim = ReadAim(frameTime);
+
+    // M1/M2 — mouse buttons OR keyboard OR gamepad triggers
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsKeyDown(KB_M1_KEY)
+        || IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_2))
+        in->down |= BTN_M1;
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsKeyPressed(KB_M1_KEY)
+        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_2))
+        in->pressed |= BTN_M1;
+    if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT) || IsKeyDown(KB_M2_KEY)
+        || IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_2))
+        in->down |= BTN_M2;
+    if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT) || IsKeyPressed(KB_M2_KEY)
+        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_2))
+        in->pressed |= BTN_M2;
+    // Dash — shared by gameplay dash, QTE timing, select screen
+    if (IsKeyPressed(KEY_SPACE)
+        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_1))
+        in->pressed |= BTN_DASH;
+    if (IsKeyPressed(WEAPON_SWAP_KEY)
+        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_THUMB))
+        in->pressed |= BTN_SWAP;
+    if (IsKeyPressed(KEY_ENTER)
+        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_FACE_DOWN))
+        in->pressed |= BTN_CONFIRM;
+    ReadAbilities(in);
+}
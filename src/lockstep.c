@@ -0,0 +1,159 @@
+// lockstep.c
+// determinism check for Step (./mecha --lockstep [ticks], no window)
+// two copies of the sim live as snapshot images. every tick each one is
+// restored, stepped with the same input frame and captured again, then the
+// two images are hashed and compared. anything Step reads that isn't in g
+// or the frame (a raylib call, a stray static, an unwritten byte) splits
+// them. the second copy runs with the particle governor at its floor, so
+// vfx thinning leaking into the sim shows up too
+// the one static that carries sim state across ticks, the flow field cache,
+// goes with its image. the rest are shared by both: vfxRng and the particle
+// ring cursor are cosmetic (particles aren't in the image either), and the
+// shot queue, collision grid and shot pass are rebuilt every tick. a new
+// static that outlives a tick needs the same treatment or this can't see it
+#include "game.h"
+
+// one loadout per primary, each a fresh combat run off the same rng stream
+#define LOCKSTEP_LOADOUTS   NUM_PRIMARY_WEAPONS
+
+// fnv-1a
+static u64 HashImage(const u8 *p, size_t n)
+{
+    u64 h = 1469598103934665603ull;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// scripted player, its own lcg so it never draws from the sim's stream.
+// wanders, sweeps its aim, holds fire in bursts and taps everything else,
+// dt wobbles between 240 fps and the DT_MAX clamp
+static u32 botRng;
+
+static u32 BotNext(void)
+{
+    botRng = botRng * 1664525u + 1013904223u;
+    return botRng >> 8;
+}
+
+static bool BotChance(u32 oneIn)
+{
+    return BotNext() % oneIn == 0;
+}
+
+static void BotInput(InputFrame *in, u32 tick)
+{
+    *in = (InputFrame){ 0 };
+    in->dt = 1.0f / 240.0f + (float)(BotNext() % 1000) * 0.001f
+        * (DT_MAX - 1.0f / 240.0f);
+    float wander = (float)tick * 0.013f;
+    in->move = (Vector2){ cosf(wander), sinf(wander * 1.7f) };
+    float moveLen = Vector2Length(in->move);
+    if (moveLen > 1.0f) in->move = Vector2Scale(in->move, 1.0f / moveLen);
+    float aim = (float)tick * 0.05f;
+    in->aim = (Vector2){ cosf(aim) * GAMEPAD_AIM_DIST,
+                         sinf(aim) * GAMEPAD_AIM_DIST };
+    if ((tick / 90) % 3 != 2) in->down |= BTN_M1;
+    if ((tick / 150) % 4 == 3) in->down |= BTN_M2;
+    if (BotChance(20)) in->pressed |= BTN_M1;
+    if (BotChance(45)) in->pressed |= BTN_M2;
+    if (BotChance(70)) in->pressed |= BTN_DASH;
+    if (BotChance(400)) in->pressed |= BTN_SWAP;
+    for (int a = 0; a < ABL_COUNT; a++) {
+        if (BotChance(120)) in->abilityPressed |= 1u << a;
+        if ((tick / 60 + (u32)a) % 5 == 0) in->abilityDown |= 1u << a;
+    }
+}
+
+// past the select screen with everything owned, like a run after the shop
+static void StartCombat(int loadout)
+{
+    InitGame();
+    g.phase = PHASE_COMBAT;
+    g.level = 1;
+    g.invincible = true;
+    g.player.primary = SELECT_WEAPONS[loadout];
+    g.player.secondary = SELECT_WEAPONS[(loadout + 1) % NUM_PRIMARY_WEAPONS];
+    for (int i = 0; i < ABILITY_SLOTS; i++) g.player.slots[i].owned = true;
+    g.player.pos = (Vector2){ MAP_LEFT + MAP_SIZE / 2.0f, MAP_SIZE / 2.0f };
+    g.player.shadowPos = g.player.pos;
+    g.camera.target = g.player.pos;
+}
+
+// restore, step, capture. the governor setting is session state, the
+// restore keeps whatever is live so it's set after
+static size_t StepImage(u8 *image, u8 *field, const InputFrame *in,
+    float particleScale)
+{
+    RestoreSnapshotImage(image);
+    RestoreFlowField(field);
+    g.vfx.particleScale = particleScale;
+    Step(in);
+    CaptureFlowField(field);
+    return CaptureSnapshot(image);
+}
+
+static size_t FirstDiff(const u8 *a, const u8 *b, size_t n)
+{
+    size_t i = 0;
+    while (i < n && a[i] == b[i]) i++;
+    return i;
+}
+
+// true when every tick matched. logs the first split it finds
+bool RunLockstep(const PoolConfig *pools, int ticks)
+{
+    InitPools(pools);
+    InitPatterns();
+    size_t slotBytes = sizeof(GameState) + PoolSnapshotBytes();
+    size_t fieldBytes = FlowFieldBytes();
+    u8 *a = MemAlloc((unsigned int)((slotBytes + fieldBytes) * 2));
+    if (!a) {
+        TraceLog(LOG_WARNING, "LOCKSTEP: no room for two %zu KiB images",
+            (slotBytes + fieldBytes) / 1024);
+        return false;
+    }
+    u8 *b = a + slotBytes;
+    u8 *fieldA = b + slotBytes;
+    u8 *fieldB = fieldA + fieldBytes;
+
+    g.rng = SIM_RNG_SEED;
+    botRng = SIM_RNG_SEED;
+    int perLoadout = (ticks + LOCKSTEP_LOADOUTS - 1) / LOCKSTEP_LOADOUTS;
+    size_t bytes = 0, peakBytes = 0;
+    u64 hash = 0;
+    bool ok = true;
+    for (int t = 0; t < ticks && ok; t++) {
+        if (t % perLoadout == 0) {
+            StartCombat(t / perLoadout);
+            bytes = CaptureSnapshot(a);
+            memcpy(b, a, bytes);
+            CaptureFlowField(fieldA);
+            CaptureFlowField(fieldB);
+        }
+        InputFrame in;
+        BotInput(&in, (u32)t);
+        size_t bytesA = StepImage(a, fieldA, &in, 1.0f);
+        size_t bytesB = StepImage(b, fieldB, &in, PARTICLE_SCALE_MIN);
+        bytes = bytesA > bytesB ? bytesA : bytesB;
+        if (bytes > peakBytes) peakBytes = bytes;
+        hash = HashImage(a, bytesA);
+        if (bytesA == bytesB && hash == HashImage(b, bytesB)) continue;
+
+        size_t at = FirstDiff(a, b, bytes);
+        TraceLog(LOG_WARNING, "LOCKSTEP: split at tick %d (loadout %d), "
+            "%zu vs %zu bytes, first difference at byte %zu (%s)",
+            t, t / perLoadout, bytesA, bytesB, at,
+            at < sizeof(GameState) ? "GameState" : "pools");
+        ok = false;
+    }
+    if (ok)
+        TraceLog(LOG_INFO, "LOCKSTEP: %d ticks over %d loadouts matched, "
+            "images up to %zu KiB, last hash %016llx",
+            ticks, LOCKSTEP_LOADOUTS, peakBytes / 1024,
+            (unsigned long long)hash);
+    MemFree(a);
+    return ok;
+}
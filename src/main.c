@@ -1,8 +1,29 @@
 // main.c
 #include "game.h"
+#include <stdlib.h>
 
-int main(void) 
+int main(int argc, char **argv) 
 {
+    // ./mecha --save-tuning writes the compiled defaults and exits
+    for (int a = 1; a < argc; a++)
+        if (strcmp(argv[a], "--save-tuning") == 0)
+            return SaveTuning(TUNING_PATH)
+                && SaveTuningText(TUNING_TEXT_PATH) ? 0 : 1;
+
+    PoolConfig pools;
+    PoolDefaultConfig(&pools);
+    PoolConfigFromArgs(&pools, argc, argv);
+
+    // ./mecha --lockstep [ticks] runs two copies of the sim side by side,
+    // no window, exits 1 on the first tick their states differ
+    for (int a = 1; a < argc; a++)
+        if (strcmp(argv[a], "--lockstep") == 0) {
+            int ticks = (a + 1 < argc) ? (int)strtol(argv[a + 1], NULL, 10) : 0;
+            LoadTuning(TUNING_PATH);
+            return RunLockstep(&pools, ticks > 0 ? ticks : LOCKSTEP_TICKS)
+                ? 0 : 1;
+        }
+
     //SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_FULLSCREEN_MODE);
     SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     InitWindow(SCREEN_W, SCREEN_H, "mecha prototype");
@@ -23,6 +44,15 @@ int main(void)
 #endif
     // this zero key could be set better?
     SetExitKey(KEY_ZERO);
+    LoadAssetBlob(ASSET_BLOB_PATH);
+    LoadTuning(TUNING_PATH);
+    InitAssetWatch(ASSET_WATCH_DIR);
+    InitPools(&pools);
+    InitSnapshots();
+    InitPatterns();
+    // the sim rolls its own numbers from here on, seeded once per run
+    g.rng = ((u32)GetRandomValue(0, 0xffff) << 16)
+        | (u32)GetRandomValue(1, 0xffff);
     InitGame();
 #ifdef PLATFORM_WEB
     emscripten_set_main_loop(NextFrame, 0, 1);
@@ -34,9 +64,13 @@ int main(void)
     SetTargetFPS(240);
     // also in firefox on linux the game doesn't go above 60 fps
     while (!WindowShouldClose()) {
+        PollAssetWatch();
+        PollTuning();
         NextFrame();
     }
 #endif
+    CloseAssetWatch();
+    UnloadAssetBlob();
     CloseWindow();
     return 0;
 }
@@ -14,6 +14,18 @@
 #include <string.h>
 #include "rtypes.h"
 #include "default.h"
+#include "tuning.h"
+
+// handles ------------------------------------------------------------------ /
+// cross-entity references, low bits are the slot, high bits the generation
+// a slot's generation bumps every time it is claimed, so a handle to a dead
+// or recycled entity fails the lookup instead of aliasing whatever moved in
+typedef u32 Handle;
+#define HANDLE_NONE         0
+#define HANDLE_INDEX_BITS   20
+#define HANDLE_INDEX_MASK   ((1u << HANDLE_INDEX_BITS) - 1)
+#define HANDLE_GEN_MAX      ((1u << (32 - HANDLE_INDEX_BITS)) - 1)
+#define NEXT_GEN(gen)       ((u16)((gen) % HANDLE_GEN_MAX + 1))   // never 0
 
 // weapon / screen types ---------------------------------------------------- /
 typedef enum WeaponType {
@@ -109,7 +121,6 @@ static const int ABILITY_COST[ABL_COUNT] = {
 // declare abilities above player
 typedef struct Gun {
     float cooldown;
-    float fireRate;
     float heat;              // 0.0 to 1.0 (normalized)
     float heatDecayWait;     // seconds since last shot, decay starts after threshold
     bool  overheated;        // locked out when true
@@ -124,9 +135,6 @@ typedef struct Gun {
 typedef struct Sword {
     float timer;
     float angle;
-    float duration;
-    float arc;
-    float radius;
     bool dashSlash;
     bool lunge;
     u8 hitBits[MAX_ENEMIES / 8];
@@ -136,12 +144,8 @@ typedef struct Sword {
 typedef struct Dash {
     bool active;
     float timer;
-    float speed;
-    float duration;
-    float rechargeTime;
     float rechargeTimer;
     int charges;
-    int maxCharges;
     Vector2 dir;
     // Super dash / decoy
     float superWindow;
@@ -154,9 +158,6 @@ typedef struct Dash {
 
 typedef struct Spin {
     float timer;
-    float duration;
-    float radius;
-    float cooldown;
     float cooldownTimer;
     u8 hitBits[MAX_ENEMIES / 8];
     float lastResetAngle;
@@ -168,7 +169,6 @@ typedef struct Shotgun {
 } Shotgun;
 
 typedef struct Rocket {
-    float cooldown;
     float cooldownTimer;
     bool inFlight;
 } Rocket;
@@ -216,8 +216,7 @@ typedef struct Bfg {
 } Bfg;
 
 typedef struct Shield {
-    float hp;           // current shield health
-    float maxHp;        // max shield health
+    float hp;           // current shield health, max is TUNE(SHIELD_MAX_HP)
     bool  active;       // true while held up
     float regenTimer;   // time since shield was lowered (regen starts after delay)
     float angle;        // facing direction (follows mouse)
@@ -254,6 +253,7 @@ typedef struct Deployable {
     float radius;       // effect radius
     float hp;           // turret health (0 = not damageable)
     bool active;
+    u16 gen;            // handle generation, bumped on spawn
     DeployableType type;
 } Deployable;
 
@@ -284,9 +284,8 @@ typedef struct Player {
     Vector2 pos;
     Vector2 vel;
     float angle;
-    float speed;
     float size;
-    float hp, maxHp;
+    float hp;           // max is TUNE(PLAYER_HP)
     float iFrames;
     Gun gun;
     Sword sword;
@@ -363,7 +362,6 @@ typedef struct Projectile {
     DamageType dmgType;
     int damage;
     bool active;
-    bool isEnemy;
     bool knockback;
     bool appliesSlow;
     u8 bounces;
@@ -371,6 +369,38 @@ typedef struct Projectile {
     float heightVel;    // visual-only: vertical velocity for bounce arc
 } Projectile;
 
+// bullet patterns fired in one EmitPattern call
+typedef enum PatternID {
+    PAT_SHOTGUN,
+    PAT_PENTA_ROWS,
+    PAT_HEXA_FAN,
+    PAT_TRAP_BURST,
+    PAT_TRAP_RING,
+    PAT_CIRC_RING,
+    PAT_CIRC_SPIRAL,
+    PAT_CIRC_SHOTGUN,
+    PAT_COUNT
+} PatternID;
+
+// static data table — shape of the pattern plus what every bullet shares
+// unit directions are built once from this by InitPatterns
+typedef struct ProjPattern {
+    int   count;        // bullets per row
+    int   rows;         // parallel rows across the aim
+    float spread;       // fan arc in radians, 2*PI = ring, 0 = straight
+    float rowOffset;    // gap between rows
+    float spacing;      // extra muzzle distance per bullet down a row
+    float speed;
+    int   damage;
+    float lifetime;
+    float size;
+    bool  isEnemy;      // which shot pool it goes in
+    bool  knockback;
+    u8    bounces;
+    ProjectileType type;
+    DamageType dmgType;
+} ProjPattern;
+
 typedef enum VfxTimerType {
     VFX_EXPLOSION,
     VFX_MINE_WEB,
@@ -391,7 +421,6 @@ typedef struct LightningArc {
     float duration;
     bool active;
     bool damageApplied;
-    int targetIdx;
 } LightningArc;
 
 typedef struct LightningChain {
@@ -402,7 +431,7 @@ typedef struct LightningChain {
     int sourceCount;
     Vector2 nextSources[BFG_MAX_CHAIN_TARGETS];
     int nextSourceCount;
-    bool hit[MAX_ENEMIES];
+    u16 hitGen[MAX_ENEMIES];    // slot hit when it matches the enemy's gen
     LightningArc arcs[BFG_MAX_ARCS];
     int arcCount;
     bool propagating;
@@ -420,6 +449,7 @@ typedef enum EnemyType {
     TRAP, // trapezoid, mini boss
     CIRC, // big circle boss?
     // one more enemy?
+    ENEMY_TYPE_COUNT
 } EnemyType;
 
 typedef struct Enemy {
@@ -429,6 +459,7 @@ typedef struct Enemy {
     float speed;
     int hp, maxHp;
     bool active;
+    u16 gen;            // handle generation, bumped on spawn
     float hitFlash;
     float shootTimer;
     int contactDamage;
@@ -439,7 +470,8 @@ typedef struct Enemy {
     float slowFactor;
     float rootTimer;    // can't move, CAN shoot
     float stunTimer;    // can't move, CAN'T shoot
-    i8 aggroIdx;        // deployable index to chase (-1 = player)
+    Handle aggro;       // deployable to chase (HANDLE_NONE = player)
+    i8 strafeSign;      // HEXA orbit direction, fixed at spawn
     u8 attackPhase;     // boss attack cycle counter
     float chargeTimer;  // boss charge duration remaining
     Vector2 chargeDir;  // committed charge direction
@@ -457,9 +489,25 @@ typedef struct Enemy {
     bool  blinkMarked;  // queued for blink damage
 } Enemy;
 
-// shoot function pointer — NULL means no shooting AI
-typedef void (*EnemyShootFn)(
-    Enemy *e, Vector2 toTarget, float dist, float dt);
+// cone/sector for arc weapons, built once per swing so the per-target test
+// is a dot product, no angles
+typedef struct ArcSector {
+    Vector2 origin;
+    Vector2 facing;     // unit vector down the middle of the arc
+    float cosHalf;      // cos(half arc), -1 = full circle
+    float radius;
+} ArcSector;
+
+// one enemy's shot check for this tick, queued by UpdateEnemies
+typedef struct ShotJob {
+    int enemy;          // slot in g.enemies
+    Vector2 toTarget;
+    float dist;
+    float dt;           // tick dt
+} ShotJob;
+
+// per-type shoot pass over that type's queued jobs — NULL means no shooting AI
+typedef void (*EnemyShootFn)(ShotJob *jobs, int n);
 
 // static data table — one row per enemy type
 typedef struct EnemyDef {
@@ -471,38 +519,99 @@ typedef struct EnemyDef {
     int   spawnKills;
     int   gold;
     int   value;
+    float mass;         // separation weight, heavier pushes lighter aside
     EnemyShootFn shoot;
 } EnemyDef;
 
 // other -------------------------------------------------------------------- /
-typedef struct Particle {
-    Vector2 pos;
-    Vector2 vel;
-    Color color;
-    float lifetime;
-    float maxLifetime;
-    float size;
-    bool active;
-} Particle;
-
-
+// particles are SoA, one array per field, so the update is a straight run
+// over each and 64K of them stay cheap. active[] is the pool's slot array
+typedef struct ParticleStore {
+    bool *active;
+    Vector2 *pos;
+    Vector2 *vel;
+    Color *color;
+    float *lifetime;
+    float *invLife;     // 1 / starting lifetime, fade = lifetime * invLife
+    float *size;
+} ParticleStore;
+
+
+
+// pools -------------------------------------------------------------------- /
+// entity pools live in one arena allocated at startup (pool.c)
+// every pool reserves its max up front so slots never move, indices and
+// pointers stay valid for the whole run. cap grows by doubling up to max
+typedef enum PoolID {
+    POOL_PLAYER_SHOT,   // player projectiles, hit enemies
+    POOL_ENEMY_SHOT,    // enemy projectiles, hit the player/shield/turrets
+    POOL_ENEMY,
+    POOL_PARTICLE,
+    POOL_DEPLOYABLE,
+    POOL_COUNT
+} PoolID;
+
+typedef struct PoolInfo {
+    int count;      // scan bound, one past the highest claimed slot
+    int cap;        // slots claimable right now
+    int max;        // hard ceiling reserved in the arena
+    int peak;       // highest count this run
+    int moved;      // slots moved by the last compaction
+    u32 grows;
+    u32 drops;      // spawns refused because the pool hit max
+    u32 recycled;   // live slots overwritten by ClaimRingSlot
+} PoolInfo;
+
+// runtime sizing, defaults from default.h, overridable from the command line
+typedef struct PoolConfig {
+    int init[POOL_COUNT];
+    int max[POOL_COUNT];
+    bool compact;   // end of tick compaction of enemies + shots
+} PoolConfig;
 
 // vfx ---------------------------------------------------------------------- /
 typedef struct VfxState {
-    Particle particles[MAX_PARTICLES];
+    ParticleStore particles;    // arena-backed, see pool.c
+    float frameTime;        // smoothed raw frame time, drives the governor
+    float particleScale;    // 0..1 share of particle spawns that go through
     Beam beams[MAX_BEAMS];
     VfxTimer timers[MAX_VFX_TIMERS];
 } VfxState;
 
+// input -------------------------------------------------------------------- /
+// one frame of player intent, sampled by the host (input.c) and handed to
+// Step. the sim reads nothing else from the outside world, so the same
+// frames fed to the same state give the same ticks
+typedef enum InputButton {
+    BTN_M1      = 1 << 0,
+    BTN_M2      = 1 << 1,
+    BTN_DASH    = 1 << 2,
+    BTN_SWAP    = 1 << 3,   // weapon swap
+    BTN_CONFIRM = 1 << 4,   // enter / pad A, select + shop + restart
+} InputButton;
+
+typedef struct InputFrame {
+    float dt;               // clamped to DT_MAX
+    Vector2 move;           // WASD / left stick, length <= 1
+    Vector2 aim;            // player -> aim point, world units
+    u16 down;               // InputButton bits held
+    u16 pressed;            // InputButton bits pressed this frame
+    u32 abilityDown;        // 1 << AbilityID, already mapped from keys/pad
+    u32 abilityPressed;
+} InputFrame;
+
 // State -------------------------------------------------------------------- /
 // this is THE piece of data that we are operating on
 // it sits inside of our pipeline
 typedef struct GameState {
     // the player entity
     Player player;
-    Projectile projectiles[MAX_PROJECTILES];
-    Enemy enemies[MAX_ENEMIES];
-    Deployable deployables[MAX_DEPLOYABLES];
+    // entity pools, bound to the arena by InitGame
+    Projectile *playerShots;
+    Projectile *enemyShots;
+    Enemy *enemies;
+    Deployable *deployables;
+    PoolInfo pool[POOL_COUNT];
     LightningChain lightning;
     // vfx event buffer — update writes, draw reads
     VfxState vfx;
@@ -510,14 +619,20 @@ typedef struct GameState {
     Camera2D camera;
     int gold;
     float spawnTimer;
-    float spawnInterval;
     int podValue;
     int enemiesKilled;
     GamePhase phase;
     int level;
     bool gameOver;
+    u32 tick;               // sim ticks since InitGame
+    float time;             // sim seconds, every Step
+    u32 rng;                // SimRandom state, kept across InitGame
     bool paused;
     bool gamepadActive;     // true = last input from gamepad
+    bool showStats;         // F3 debug overlay
+    float stepMs;           // Step time, smoothed
+    int snapBytes;          // last snapshot image, F3
+    float snapDelta;        // its delta against the tick before, smoothed
     int selectIndex;
     int selectPhase;    // 0 = picking primary, 1 = picking secondary
     float selectDemoTimer;
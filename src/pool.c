@@ -0,0 +1,412 @@
+// pool.c
+// the entity pool arena, one allocation for every pool, carved at startup
+#include "game.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+// arena -------------------------------------------------------------------- /
+// bump allocator, never frees, lives for the whole process
+// each pool reserves its max so growth never relocates anything
+// MemAlloc is calloc, untouched pages stay lazily committed on native
+typedef struct Arena {
+    u8 *base;
+    size_t size;
+    size_t used;
+} Arena;
+
+static Arena arena;
+
+static void *ArenaPush(Arena *a, size_t bytes)
+{
+    uintptr_t top = (uintptr_t)(a->base + a->used);
+    size_t at = a->used + (size_t)(-top & (POOL_ARENA_ALIGN - 1));
+    if (at + bytes > a->size) return NULL;
+    a->used = at + bytes;
+    return a->base + at;
+}
+
+// pools -------------------------------------------------------------------- /
+// stride + offset of the active flag lets one claim loop serve every type
+static const struct {
+    const char *name;
+    size_t stride;
+    size_t activeOff;
+    int ceiling;
+} POOL_LAYOUT[POOL_COUNT] = {
+    [POOL_PLAYER_SHOT] = { "player-shot", sizeof(Projectile),
+                          offsetof(Projectile, active), MAX_PLAYER_SHOTS },
+    [POOL_ENEMY_SHOT] = { "enemy-shot", sizeof(Projectile),
+                          offsetof(Projectile, active), MAX_ENEMY_SHOTS },
+    [POOL_ENEMY]      = { "enemy",      sizeof(Enemy),
+                          offsetof(Enemy, active),      MAX_ENEMIES },
+    [POOL_PARTICLE]   = { "particle",   sizeof(bool),
+                          0,                            MAX_PARTICLES },
+    [POOL_DEPLOYABLE] = { "deployable", sizeof(Deployable),
+                          offsetof(Deployable, active), MAX_DEPLOYABLES },
+};
+
+static PoolConfig config;
+static u8 *poolBase[POOL_COUNT];
+static Enemy *enemyScratch;         // staging for ReorderEnemies
+static ParticleStore particleFields;    // the rest of the particle SoA
+static int touched[POOL_COUNT];     // slots dirtied since the last reset
+static int ringNext[POOL_COUNT];    // ClaimRingSlot cursor
+
+static inline bool SlotActive(PoolID id, int i)
+{
+    return *(const bool *)(poolBase[id]
+        + (size_t)i * POOL_LAYOUT[id].stride + POOL_LAYOUT[id].activeOff);
+}
+
+const char *PoolName(PoolID id)
+{
+    return POOL_LAYOUT[id].name;
+}
+
+void PoolDefaultConfig(PoolConfig *cfg)
+{
+    cfg->init[POOL_PLAYER_SHOT] = POOL_PLAYER_SHOT_INIT;
+    cfg->init[POOL_ENEMY_SHOT] = POOL_ENEMY_SHOT_INIT;
+    cfg->init[POOL_ENEMY]      = POOL_ENEMY_INIT;
+    cfg->init[POOL_PARTICLE]   = POOL_PARTICLE_INIT;
+    cfg->init[POOL_DEPLOYABLE] = POOL_DEPLOYABLE_INIT;
+    for (int i = 0; i < POOL_COUNT; i++)
+        cfg->max[i] = POOL_LAYOUT[i].ceiling;
+    cfg->compact = POOL_COMPACT;
+}
+
+// --pool-enemy=2048 or --pool-enemy=2048:8192, --no-compact
+// unknown args are ignored
+void PoolConfigFromArgs(PoolConfig *cfg, int argc, char **argv)
+{
+    for (int a = 1; a < argc; a++) {
+        const char *arg = argv[a];
+        if (strcmp(arg, "--no-compact") == 0) cfg->compact = false;
+        if (strncmp(arg, "--pool-", 7) != 0) continue;
+        arg += 7;
+        for (int i = 0; i < POOL_COUNT; i++) {
+            size_t n = strlen(POOL_LAYOUT[i].name);
+            if (strncmp(arg, POOL_LAYOUT[i].name, n) != 0 || arg[n] != '=')
+                continue;
+            char *end;
+            long init = strtol(arg + n + 1, &end, 10);
+            long max = (*end == ':') ? strtol(end + 1, NULL, 10) : init;
+            if (init > 0) cfg->init[i] = (int)init;
+            if (max > 0) cfg->max[i] = (int)max;
+        }
+    }
+}
+
+// reserve every pool in one allocation, call once before InitGame
+void InitPools(const PoolConfig *cfg)
+{
+    config = *cfg;
+    size_t total = 0;
+    for (int i = 0; i < POOL_COUNT; i++) {
+        int *max = &config.max[i];
+        int *init = &config.init[i];
+        if (*max > POOL_LAYOUT[i].ceiling) *max = POOL_LAYOUT[i].ceiling;
+        if (*max < 1) *max = 1;
+        if (*init > *max) *init = *max;
+        if (*init < 1) *init = 1;
+        total += (size_t)*max * POOL_LAYOUT[i].stride + POOL_ARENA_ALIGN;
+    }
+    total += (size_t)config.max[POOL_ENEMY] * sizeof(Enemy) + POOL_ARENA_ALIGN;
+    // the particle pool region is just active[], the fields ride alongside
+    total += (size_t)config.max[POOL_PARTICLE]
+        * (2 * sizeof(Vector2) + sizeof(Color) + 3 * sizeof(float))
+        + 6 * POOL_ARENA_ALIGN;
+
+    arena.base = MemAlloc((unsigned int)total);
+    arena.size = arena.base ? total : 0;
+    if (!arena.base) {
+        TraceLog(LOG_FATAL, "POOL: failed to reserve %zu byte arena", total);
+        return;
+    }
+
+    for (int i = 0; i < POOL_COUNT; i++) {
+        poolBase[i] = ArenaPush(&arena,
+            (size_t)config.max[i] * POOL_LAYOUT[i].stride);
+        TraceLog(LOG_INFO, "POOL: %-10s init %5d max %5d (%zu bytes)",
+            POOL_LAYOUT[i].name, config.init[i], config.max[i],
+            (size_t)config.max[i] * POOL_LAYOUT[i].stride);
+    }
+    enemyScratch = ArenaPush(&arena,
+        (size_t)config.max[POOL_ENEMY] * sizeof(Enemy));
+
+    size_t np = (size_t)config.max[POOL_PARTICLE];
+    particleFields.pos      = ArenaPush(&arena, np * sizeof(Vector2));
+    particleFields.vel      = ArenaPush(&arena, np * sizeof(Vector2));
+    particleFields.color    = ArenaPush(&arena, np * sizeof(Color));
+    particleFields.lifetime = ArenaPush(&arena, np * sizeof(float));
+    particleFields.invLife  = ArenaPush(&arena, np * sizeof(float));
+    particleFields.size     = ArenaPush(&arena, np * sizeof(float));
+}
+
+// wipe whatever the previous run touched and rebind g to the arena
+// InitGame calls this right after its memset
+void ResetPools(void)
+{
+    for (int i = 0; i < POOL_COUNT; i++) {
+        memset(poolBase[i], 0, (size_t)touched[i] * POOL_LAYOUT[i].stride);
+        touched[i] = 0;
+        ringNext[i] = 0;
+        g.pool[i] = (PoolInfo){
+            .count = 0, .cap = config.init[i], .max = config.max[i] };
+    }
+    g.playerShots     = (Projectile *)poolBase[POOL_PLAYER_SHOT];
+    g.enemyShots      = (Projectile *)poolBase[POOL_ENEMY_SHOT];
+    g.enemies         = (Enemy *)poolBase[POOL_ENEMY];
+    // spawns write every field, only active[] needs the wipe above
+    g.vfx.particles        = particleFields;
+    g.vfx.particles.active = (bool *)poolBase[POOL_PARTICLE];
+    g.deployables     = (Deployable *)poolBase[POOL_DEPLOYABLE];
+}
+
+static bool GrowPool(PoolID id)
+{
+    PoolInfo *p = &g.pool[id];
+    if (p->cap >= p->max) return false;
+    int cap = p->cap * 2;
+    if (cap > p->max) cap = p->max;
+    p->cap = cap;
+    p->grows++;
+    TraceLog(LOG_INFO, "POOL: %s grew to %d", POOL_LAYOUT[id].name, cap);
+    return true;
+}
+
+// claims up to n slots into out[] in one scan: holes below count first, in
+// order, then a contiguous run appended at the tail. returns how many it got,
+// short only when the pool is at max. the caller fills them and sets active
+int ClaimSlots(PoolID id, int n, int *out)
+{
+    PoolInfo *p = &g.pool[id];
+    int got = 0;
+    for (int i = 0; i < p->count && got < n; i++)
+        if (!SlotActive(id, i)) out[got++] = i;
+
+    while (got < n) {
+        if (p->count >= p->cap && !GrowPool(id)) {
+            // loud on the first drop and every power of two after that
+            for (; got < n; n--) {
+                p->drops++;
+                if ((p->drops & (p->drops - 1)) == 0)
+                    TraceLog(LOG_WARNING,
+                        "POOL: %s full at %d, %u spawns dropped",
+                        POOL_LAYOUT[id].name, p->max, p->drops);
+            }
+            break;
+        }
+        out[got++] = p->count++;
+    }
+    if (p->count > p->peak) p->peak = p->count;
+    if (p->count > touched[id]) touched[id] = p->count;
+    return got;
+}
+
+// returns the lowest free slot, or -1 when the pool is at max
+// the caller fills the slot and sets active
+int ClaimSlot(PoolID id)
+{
+    int i;
+    return ClaimSlots(id, 1, &i) ? i : -1;
+}
+
+// ring claim for pools where losing the oldest beats losing the newest
+// (particles, the big death bursts are the ones that hit a full pool)
+// the cursor walks [0, cap) in spawn order, no scan. a live slot under it
+// grows the pool if it can, at max it's the oldest spawn and gets reused.
+// never fails, the caller overwrites the whole slot
+int ClaimRingSlot(PoolID id)
+{
+    PoolInfo *p = &g.pool[id];
+    int i = ringNext[id];
+    if (i >= p->cap) i = 0;
+    if (SlotActive(id, i)) {
+        int old = p->cap;
+        if (GrowPool(id)) {
+            i = old;
+        } else {
+            p->recycled++;
+        }
+    }
+    ringNext[id] = i + 1;
+    if (i >= p->count) p->count = i + 1;
+    if (p->count > p->peak) p->peak = p->count;
+    if (p->count > touched[id]) touched[id] = p->count;
+    return i;
+}
+
+// pull each scan bound back past the dead tail, once per frame
+void TrimPools(void)
+{
+    for (int i = 0; i < POOL_COUNT; i++) {
+        PoolInfo *p = &g.pool[i];
+        while (p->count > 0 && !SlotActive((PoolID)i, p->count - 1))
+            p->count--;
+    }
+}
+
+// compaction --------------------------------------------------------------- /
+// stable two-pointer pass, live entries slide down keeping their order so
+// [0, count) stays dense. map[old] = new slot, -1 for the dead
+static int remap[MAX_ENEMIES];
+
+static int CompactPool(PoolID id, int *map)
+{
+    PoolInfo *p = &g.pool[id];
+    size_t stride = POOL_LAYOUT[id].stride;
+    u8 *base = poolBase[id];
+    int live = 0;
+    int moved = 0;
+    for (int i = 0; i < p->count; i++) {
+        if (!SlotActive(id, i)) {
+            if (map) map[i] = -1;
+            continue;
+        }
+        if (map) map[i] = live;
+        if (i != live) {
+            memcpy(base + (size_t)live * stride,
+                   base + (size_t)i * stride, stride);
+            moved++;
+        }
+        live++;
+    }
+    // the vacated tail still holds active copies of whatever moved down
+    for (int i = live; i < p->count; i++)
+        *(bool *)(base + (size_t)i * stride + POOL_LAYOUT[id].activeOff) = false;
+    p->count = live;
+    p->moved = moved;
+    return moved;
+}
+
+static void RemapHitBits(u8 *bits, const int *map, int oldCount)
+{
+    u8 out[MAX_ENEMIES / 8] = { 0 };
+    for (int i = 0; i < oldCount; i++) {
+        if (map[i] < 0 || !(bits[i >> 3] & (1 << (i & 7)))) continue;
+        out[map[i] >> 3] |= (u8)(1 << (map[i] & 7));
+    }
+    memcpy(bits, out, sizeof(out));
+}
+
+// everything that stores an enemy slot across frames has to follow it
+static void RemapEnemyRefs(const int *map, int oldCount)
+{
+    LightningChain *lc = &g.lightning;
+    if (lc->active) {
+        static u16 hitGen[MAX_ENEMIES];
+        memset(hitGen, 0, (size_t)oldCount * sizeof(u16));
+        for (int i = 0; i < oldCount; i++)
+            if (map[i] >= 0) hitGen[map[i]] = lc->hitGen[i];
+        memcpy(lc->hitGen, hitGen, (size_t)oldCount * sizeof(u16));
+    }
+    RemapHitBits(g.player.sword.hitBits, map, oldCount);
+    RemapHitBits(g.player.spin.hitBits, map, oldCount);
+}
+
+// slot k gets old slot order[k], anything not listed is dropped so order
+// must hold every live enemy exactly once. tick boundaries only
+void ReorderEnemies(const int *order, int n)
+{
+    PoolInfo *p = &g.pool[POOL_ENEMY];
+    int oldCount = p->count;
+    int moved = 0;
+    for (int i = 0; i < oldCount; i++)
+        remap[i] = -1;
+    for (int k = 0; k < n; k++) {
+        enemyScratch[k] = g.enemies[order[k]];
+        remap[order[k]] = k;
+        if (order[k] != k) moved++;
+    }
+    memcpy(g.enemies, enemyScratch, (size_t)n * sizeof(Enemy));
+    for (int i = n; i < oldCount; i++)
+        g.enemies[i].active = false;
+    p->count = n;
+    p->moved = moved;
+    if (moved > 0 || n < oldCount) RemapEnemyRefs(remap, oldCount);
+}
+
+// end of tick: compact enemies + shots, then trim the other pools
+// nothing may hold a raw enemy index across this call, use a Handle
+void CompactPools(void)
+{
+    if (config.compact) {
+        int oldCount = g.pool[POOL_ENEMY].count;
+        if (CompactPool(POOL_ENEMY, remap) > 0)
+            RemapEnemyRefs(remap, oldCount);
+        CompactPool(POOL_PLAYER_SHOT, NULL);
+        CompactPool(POOL_ENEMY_SHOT, NULL);
+    }
+    TrimPools();
+}
+
+// handles ------------------------------------------------------------------ /
+_Static_assert(MAX_DEPLOYABLES <= HANDLE_INDEX_MASK,
+    "pool too big for handle index");
+
+Handle DeployableHandle(int idx)
+{
+    return ((Handle)g.deployables[idx].gen << HANDLE_INDEX_BITS) | (Handle)idx;
+}
+
+Deployable *GetDeployable(Handle h)
+{
+    u32 idx = h & HANDLE_INDEX_MASK;
+    if (h == HANDLE_NONE || idx >= (u32)g.pool[POOL_DEPLOYABLE].count)
+        return NULL;
+    Deployable *d = &g.deployables[idx];
+    if (!d->active || d->gen != (h >> HANDLE_INDEX_BITS)) return NULL;
+    return d;
+}
+
+// snapshots -------------------------------------------------------------- /
+// a pool's share of a snapshot is every slot it has touched since the last
+// reset, not just [0, count). dead slots still carry state: the handle gen
+// the next spawn bumps, and whatever fields that spawn doesn't rewrite.
+// particles stay out, they're draw-only and gone in under a second anyway
+size_t PoolSnapshotBytes(void)
+{
+    size_t bytes = 0;
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if (i == POOL_PARTICLE) continue;
+        bytes += sizeof(u32) + (size_t)config.max[i] * POOL_LAYOUT[i].stride;
+    }
+    return bytes;
+}
+
+// writes every pool but the particles to out, returns the bytes used.
+// each pool is its byte length then the slots, so the snapshot can be
+// walked without knowing the strides
+size_t SavePools(u8 *out)
+{
+    u8 *p = out;
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if (i == POOL_PARTICLE) continue;
+        u32 bytes = (u32)((size_t)touched[i] * POOL_LAYOUT[i].stride);
+        memcpy(p, &bytes, sizeof(bytes));
+        memcpy(p + sizeof(bytes), poolBase[i], bytes);
+        p += sizeof(bytes) + bytes;
+    }
+    return (size_t)(p - out);
+}
+
+// the other half of SavePools. past the saved range everything was still
+// zero when the snapshot was taken, so whatever got dirtied since goes back
+void LoadPools(const u8 *in)
+{
+    const u8 *p = in;
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if (i == POOL_PARTICLE) continue;
+        u32 bytes;
+        size_t stride = POOL_LAYOUT[i].stride;
+        memcpy(&bytes, p, sizeof(bytes));
+        memcpy(poolBase[i], p + sizeof(bytes), bytes);
+        int saved = (int)(bytes / stride);
+        if (touched[i] > saved)
+            memset(poolBase[i] + (size_t)saved * stride, 0,
+                (size_t)(touched[i] - saved) * stride);
+        touched[i] = saved;
+        p += sizeof(bytes) + bytes;
+    }
+}
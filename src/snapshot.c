@@ -0,0 +1,323 @@
+// snapshot.c
+// whole state snapshots in a ring preallocated at startup
+// g has no pointers of its own besides the pool bindings, and the pools
+// never move, so a snapshot is one memcpy of g plus the touched part of each
+// pool. F5 saves, F9 goes back to the last save (native only, F5 is reload
+// in a browser)
+//
+// an image is [GameState][u32 bytes][slots] per saved pool (see SavePools).
+// images delta encode against each other for replays and, later, the wire
+#include "game.h"
+
+typedef struct Snapshot {
+    u8 *data;           // image, snap.slotBytes reserved
+    size_t bytes;       // used, 0 = empty slot
+    u32 tick;           // g.tick when it was taken
+    u32 seq;            // save order, newer wins between equal ticks
+} Snapshot;
+
+static struct {
+    u8 *mem;
+    size_t slotBytes;
+    int next;           // slot the next save overwrites
+    u32 seq;
+    Snapshot ring[SNAPSHOT_RING];
+    // MeasureSnapshotDelta, this tick and the one before
+    u8 *img[2];
+    size_t imgBytes[2];
+    int cur;
+    u8 *delta;          // SnapshotDeltaBound() bytes
+    u32 measured;       // ticks measured since the last log
+} snap;
+
+// after InitPools, the slot size comes from the pool maxes
+void InitSnapshots(void)
+{
+    size_t bytes = sizeof(GameState) + PoolSnapshotBytes();
+    snap.slotBytes = (bytes + POOL_ARENA_ALIGN - 1)
+        & ~(size_t)(POOL_ARENA_ALIGN - 1);
+    size_t total = snap.slotBytes * (SNAPSHOT_RING + 2) + SnapshotDeltaBound();
+    snap.mem = MemAlloc((unsigned int)total);
+    if (!snap.mem) {
+        TraceLog(LOG_WARNING, "SNAP: no room for %d x %zu bytes, disabled",
+            SNAPSHOT_RING, snap.slotBytes);
+        return;
+    }
+    for (int i = 0; i < SNAPSHOT_RING; i++)
+        snap.ring[i].data = snap.mem + (size_t)i * snap.slotBytes;
+    snap.img[0] = snap.mem + (size_t)SNAPSHOT_RING * snap.slotBytes;
+    snap.img[1] = snap.img[0] + snap.slotBytes;
+    snap.delta = snap.img[1] + snap.slotBytes;
+    TraceLog(LOG_INFO, "SNAP: %d slots, %zu KiB each at most",
+        SNAPSHOT_RING, snap.slotBytes / 1024);
+}
+
+size_t SnapshotBytes(void)
+{
+    return snap.slotBytes;
+}
+
+// the parts of g that belong to this process and this session, not the sim:
+// the arena bindings, window sized camera offset and zoom, pause, input
+// mode, the F3 overlay and its stats, frame timing and the particles (not in
+// the image). the camera target is sim side, it comes back with the player
+static void CopySession(GameState *dst, const GameState *src)
+{
+    dst->playerShots = src->playerShots;
+    dst->enemyShots = src->enemyShots;
+    dst->enemies = src->enemies;
+    dst->deployables = src->deployables;
+    dst->camera.offset = src->camera.offset;
+    dst->camera.zoom = src->camera.zoom;
+    dst->paused = src->paused;
+    dst->gamepadActive = src->gamepadActive;
+    dst->showStats = src->showStats;
+    dst->stepMs = src->stepMs;
+    dst->snapBytes = src->snapBytes;
+    dst->snapDelta = src->snapDelta;
+    dst->pool[POOL_PARTICLE] = src->pool[POOL_PARTICLE];
+    dst->vfx.particles = src->vfx.particles;
+    dst->vfx.frameTime = src->vfx.frameTime;
+    dst->vfx.particleScale = src->vfx.particleScale;
+}
+
+// out needs SnapshotBytes(). the session fields go in zeroed, restore keeps
+// the live ones anyway and this way they don't churn every delta
+size_t CaptureSnapshot(u8 *out)
+{
+    static const GameState blank;
+    memcpy(out, &g, sizeof(g));
+    CopySession((GameState *)out, &blank);
+    return sizeof(g) + SavePools(out + sizeof(g));
+}
+
+void RestoreSnapshotImage(const u8 *image)
+{
+    static GameState live;      // too big for the web stack
+    live = g;
+    LoadPools(image + sizeof(GameState));
+    memcpy(&g, image, sizeof(g));
+    CopySession(&g, &live);
+}
+
+// overwrites the oldest slot
+bool SaveSnapshot(void)
+{
+    if (!snap.mem) return false;
+    double t0 = GetTime();
+    Snapshot *s = &snap.ring[snap.next];
+    s->bytes = CaptureSnapshot(s->data);
+    s->tick = g.tick;
+    s->seq = ++snap.seq;
+    snap.next = (snap.next + 1) % SNAPSHOT_RING;
+    TraceLog(LOG_INFO, "SNAP: saved tick %u, %zu KiB in %.0f us",
+        s->tick, s->bytes / 1024, (GetTime() - t0) * 1e6);
+    return true;
+}
+
+static void Restore(const Snapshot *s)
+{
+    double t0 = GetTime();
+    RestoreSnapshotImage(s->data);
+    TraceLog(LOG_INFO, "SNAP: restored tick %u, %zu KiB in %.0f us",
+        s->tick, s->bytes / 1024, (GetTime() - t0) * 1e6);
+}
+
+// closest snapshot at or before tick, false when there isn't one.
+// the ring outlives InitGame, a restart can still go back to the last run
+bool RestoreSnapshot(u32 tick)
+{
+    const Snapshot *best = NULL;
+    for (int i = 0; i < SNAPSHOT_RING; i++) {
+        const Snapshot *s = &snap.ring[i];
+        if (!s->bytes || s->tick > tick) continue;
+        if (!best || s->tick > best->tick
+            || (s->tick == best->tick && s->seq > best->seq))
+            best = s;
+    }
+    if (!best) {
+        TraceLog(LOG_INFO, "SNAP: nothing saved at or before tick %u", tick);
+        return false;
+    }
+    Restore(best);
+    return true;
+}
+
+// last one saved, whatever its tick
+bool RestoreLatestSnapshot(void)
+{
+    const Snapshot *best = NULL;
+    for (int i = 0; i < SNAPSHOT_RING; i++) {
+        const Snapshot *s = &snap.ring[i];
+        if (s->bytes && (!best || s->seq > best->seq)) best = s;
+    }
+    if (!best) {
+        TraceLog(LOG_INFO, "SNAP: nothing saved yet");
+        return false;
+    }
+    Restore(best);
+    return true;
+}
+
+// delta encoding ----------------------------------------------------------- /
+// an image XORed against a baseline image, anything that didn't change is a
+// zero. sections are g, then each saved pool (varint length up front).
+// inside a section it's pairs of varint zero run, varint literal length,
+// literal bytes, until the section is covered. past the end of the
+// baseline's section counts as zero, which it was when the baseline was
+// taken. a NULL baseline is a keyframe, every section against zeros.
+// dead pool slots aren't dropped, they're state (see SavePools), but a slot
+// that stayed dead is all zeros and costs nothing
+#define DELTA_MIN_RUN   3       // shorter zero runs stay in the literal
+
+static u8 *PutVarint(u8 *p, u32 v)
+{
+    while (v >= 0x80) {
+        *p++ = (u8)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (u8)v;
+    return p;
+}
+
+// NULL on a truncated or overlong varint
+static const u8 *GetVarint(const u8 *p, const u8 *end, u32 *v)
+{
+    *v = 0;
+    for (int shift = 0; shift < 35 && p < end; shift += 7) {
+        u8 b = *p++;
+        *v |= (u32)(b & 0x7f) << shift;
+        if (!(b & 0x80)) return p;
+    }
+    return NULL;
+}
+
+static inline u8 XorAt(const u8 *cur, const u8 *base, u32 blen, u32 i)
+{
+    return cur[i] ^ (i < blen ? base[i] : 0);
+}
+
+static u8 *EncodeSection(u8 *out, const u8 *cur, u32 len,
+    const u8 *base, u32 blen)
+{
+    u32 i = 0;
+    while (i < len) {
+        // unchanged stretches are the bulk of it, skip them a word at a time
+        u32 run = i;
+        u32 both = len < blen ? len : blen;
+        while (run + 8 <= both) {
+            u64 a, b;
+            memcpy(&a, cur + run, 8);
+            memcpy(&b, base + run, 8);
+            if (a != b) break;
+            run += 8;
+        }
+        while (run < len && XorAt(cur, base, blen, run) == 0) run++;
+        // literal up to the next DELTA_MIN_RUN zeros, or the end
+        u32 j = run, zeros = 0;
+        for (; j < len; j++) {
+            if (XorAt(cur, base, blen, j)) zeros = 0;
+            else if (++zeros == DELTA_MIN_RUN) { j++; break; }
+        }
+        u32 lit = j - zeros;
+        out = PutVarint(out, run - i);
+        out = PutVarint(out, lit - run);
+        for (u32 k = run; k < lit; k++) *out++ = XorAt(cur, base, blen, k);
+        i = lit;
+    }
+    return out;
+}
+
+// worst case for one delta, a section can grow by its headers but no more
+size_t SnapshotDeltaBound(void)
+{
+    return snap.slotBytes + 16 * (POOL_COUNT + 1);
+}
+
+// base NULL for a keyframe. out needs SnapshotDeltaBound()
+size_t EncodeSnapshotDelta(const u8 *base, size_t baseBytes,
+    const u8 *cur, size_t curBytes, u8 *out)
+{
+    u8 *o = EncodeSection(out, cur, sizeof(GameState),
+        base, base ? sizeof(GameState) : 0);
+    size_t c = sizeof(GameState), b = sizeof(GameState);
+    while (c < curBytes) {
+        u32 len, blen = 0;
+        memcpy(&len, cur + c, sizeof(len));
+        c += sizeof(len);
+        if (base && b < baseBytes) {
+            memcpy(&blen, base + b, sizeof(blen));
+            b += sizeof(blen);
+        }
+        o = PutVarint(o, len);
+        o = EncodeSection(o, cur + c, len, base ? base + b : NULL, blen);
+        c += len;
+        b += blen;
+    }
+    return (size_t)(o - out);
+}
+
+// rebuilds the image into out (SnapshotBytes() of room), returns its size
+// or 0 when the delta doesn't fit the baseline or runs off either end
+size_t DecodeSnapshotDelta(const u8 *base, size_t baseBytes,
+    const u8 *delta, size_t deltaBytes, u8 *out)
+{
+    const u8 *p = delta, *end = delta + deltaBytes;
+    size_t o = 0, b = 0;
+    for (bool first = true; p < end || first; first = false) {
+        u32 len = sizeof(GameState), blen = base ? sizeof(GameState) : 0;
+        if (!first) {
+            if (!(p = GetVarint(p, end, &len))) return 0;
+            if (o + sizeof(len) + len > snap.slotBytes) return 0;
+            memcpy(out + o, &len, sizeof(len));
+            o += sizeof(len);
+            blen = 0;
+            if (base && b < baseBytes) {
+                memcpy(&blen, base + b, sizeof(blen));
+                b += sizeof(blen);
+            }
+        }
+        if (b + blen > baseBytes) return 0;
+        const u8 *bs = base ? base + b : NULL;
+        u8 *sec = out + o;
+        for (u32 i = 0; i < len;) {
+            u32 run, lit;
+            if (!(p = GetVarint(p, end, &run))) return 0;
+            if (!(p = GetVarint(p, end, &lit))) return 0;
+            if (run > len - i || lit > len - i - run
+                || lit > (size_t)(end - p)) return 0;
+            for (u32 k = i + run; i < k; i++) sec[i] = i < blen ? bs[i] : 0;
+            for (u32 k = 0; k < lit; k++, i++)
+                sec[i] = *p++ ^ (i < blen ? bs[i] : 0);
+        }
+        o += len;
+        b += blen;
+    }
+    return o;
+}
+
+// F3 meter, once a tick: image the state, delta it against last tick's and
+// keep the size smoothed for the stats overlay. logged every
+// SNAPSHOT_DELTA_LOG ticks with a keyframe to compare against
+void MeasureSnapshotDelta(void)
+{
+    if (!snap.mem) return;
+    int prev = snap.cur;
+    snap.cur ^= 1;
+    u8 *img = snap.img[snap.cur];
+    size_t bytes = CaptureSnapshot(img);
+    snap.imgBytes[snap.cur] = bytes;
+    size_t delta = EncodeSnapshotDelta(snap.img[prev], snap.imgBytes[prev],
+        img, bytes, snap.delta);
+    if (!snap.imgBytes[prev]) {
+        g.snapDelta = (float)delta;     // first tick is a keyframe
+    } else {
+        g.snapDelta += ((float)delta - g.snapDelta) * SNAPSHOT_DELTA_SMOOTH;
+    }
+    g.snapBytes = (int)bytes;
+    if (++snap.measured < SNAPSHOT_DELTA_LOG) return;
+    snap.measured = 0;
+    size_t key = EncodeSnapshotDelta(NULL, 0, img, bytes, snap.delta);
+    TraceLog(LOG_INFO, "SNAP: %.0f bytes/tick delta, %zu KiB keyframe, "
+        "%zu KiB image", (double)g.snapDelta, key / 1024, bytes / 1024);
+}
@@ -3,16 +3,37 @@
 #include "game.h"
 
 // enemy shoot functions --------------------------------------------------- /
-static void ShootRect(Enemy *e, Vector2 toTarget, float dist, float dt) {
-    e->shootTimer -= dt;
-    if (e->shootTimer <= 0 && dist > 1.0f) {
-        e->shootTimer = RECT_SHOOT_INTERVAL;
-        Vector2 shootDir = Vector2Scale(toTarget, 1.0f / dist);
+// each type gets one pass over its queued enemies: tick every shoot timer in
+// a tight loop, pack the ones that fire to the front, then emit their bullets
+
+static ShotJob shotQueue[MAX_ENEMIES];     // filled by UpdateEnemies
+static ShotJob shotSorted[MAX_ENEMIES];    // same jobs bucketed by type
+static int shotCount;
+
+// returns how many fired, those jobs are moved to jobs[0..fired)
+static int TickShotTimers(ShotJob *jobs, int n, float interval) {
+    int fired = 0;
+    for (int k = 0; k < n; k++) {
+        Enemy *e = &g.enemies[jobs[k].enemy];
+        e->shootTimer -= jobs[k].dt;
+        if (e->shootTimer <= 0 && jobs[k].dist > 1.0f) {
+            e->shootTimer = interval;
+            jobs[fired++] = jobs[k];
+        }
+    }
+    return fired;
+}
+
+static void ShootRect(ShotJob *jobs, int n) {
+    int fired = TickShotTimers(jobs, n, TUNE(RECT_SHOOT_INTERVAL));
+    for (int k = 0; k < fired; k++) {
+        Enemy *e = &g.enemies[jobs[k].enemy];
+        Vector2 shootDir = Vector2Scale(jobs[k].toTarget, 1.0f / jobs[k].dist);
         Vector2 muzzle = Vector2Add(e->pos,
             Vector2Scale(shootDir, e->size + MUZZLE_OFFSET));
-        SpawnProjectile(muzzle, shootDir, RECT_BULLET_SPEED,
-            RECT_BULLET_DAMAGE, RECT_BULLET_LIFETIME,
-            RECT_PROJECTILE_SIZE, true, false,
+        SpawnProjectile(muzzle, shootDir, TUNE(RECT_BULLET_SPEED),
+            TUNE(RECT_BULLET_DAMAGE), TUNE(RECT_BULLET_LIFETIME),
+            TUNE(RECT_PROJECTILE_SIZE), true, false,
             PROJ_BULLET, DMG_BALLISTIC);
         SpawnParticle(muzzle,
             Vector2Scale(shootDir, ENEMY_MUZZLE_SPEED),
@@ -20,28 +41,14 @@ static void ShootRect(Enemy *e, Vector2 toTarget, float dist, float dt) {
     }
 }
 
-static void ShootPenta(Enemy *e, Vector2 toTarget, float dist, float dt) {
-    e->shootTimer -= dt;
-    if (e->shootTimer <= 0 && dist > 1.0f) {
-        e->shootTimer = PENTA_SHOOT_INTERVAL;
-        Vector2 shootDir = Vector2Scale(toTarget, 1.0f / dist);
+static void ShootPenta(ShotJob *jobs, int n) {
+    int fired = TickShotTimers(jobs, n, TUNE(PENTA_SHOOT_INTERVAL));
+    for (int k = 0; k < fired; k++) {
+        Enemy *e = &g.enemies[jobs[k].enemy];
+        Vector2 shootDir = Vector2Scale(jobs[k].toTarget, 1.0f / jobs[k].dist);
         Vector2 perp = { -shootDir.y, shootDir.x };
-
-        for (int r = -1; r <= 1; r += 2) {
-            Vector2 rowOff = Vector2Scale(perp,
-                PENTA_ROW_OFFSET * r);
-            for (int b = 0; b < PENTA_BULLETS_PER_ROW; b++) {
-                Vector2 bpos = Vector2Add(e->pos, rowOff);
-                bpos = Vector2Add(bpos,
-                    Vector2Scale(shootDir,
-                        e->size + MUZZLE_OFFSET
-                        + b * PENTA_BULLET_SPACING));
-                SpawnProjectile(bpos, shootDir,
-                    PENTA_BULLET_SPEED, PENTA_BULLET_DAMAGE,
-                    PENTA_BULLET_LIFETIME, PENTA_PROJECTILE_SIZE,
-                    true, false, PROJ_BULLET, DMG_BALLISTIC);
-            }
-        }
+        EmitPattern(PAT_PENTA_ROWS, e->pos, shootDir,
+            e->size + MUZZLE_OFFSET);
         Vector2 muzzle = Vector2Add(e->pos,
             Vector2Scale(shootDir, e->size + MUZZLE_OFFSET));
         SpawnParticle(muzzle,
@@ -56,25 +63,12 @@ static void ShootPenta(Enemy *e, Vector2 toTarget, float dist, float dt) {
     }
 }
 
-static void ShootHexa(Enemy *e, Vector2 toTarget, float dist, float dt) {
-    e->shootTimer -= dt;
-    if (e->shootTimer <= 0 && dist > 1.0f) {
-        e->shootTimer = HEXA_SHOOT_INTERVAL;
-        Vector2 shootDir = Vector2Scale(toTarget, 1.0f / dist);
-        float baseAngle = atan2f(shootDir.y, shootDir.x);
-        float halfSpread = HEXA_FAN_SPREAD / 2.0f;
-        float step = HEXA_FAN_SPREAD / (HEXA_FAN_COUNT - 1);
-
-        for (int b = 0; b < HEXA_FAN_COUNT; b++) {
-            float angle = baseAngle - halfSpread + step * b;
-            Vector2 dir = { cosf(angle), sinf(angle) };
-            Vector2 muzzle = Vector2Add(e->pos,
-                Vector2Scale(dir, e->size + MUZZLE_OFFSET));
-            SpawnProjectile(muzzle, dir, HEXA_BULLET_SPEED,
-                HEXA_BULLET_DAMAGE, HEXA_BULLET_LIFETIME,
-                HEXA_PROJECTILE_SIZE, true, false,
-                PROJ_BULLET, DMG_BALLISTIC);
-        }
+static void ShootHexa(ShotJob *jobs, int n) {
+    int fired = TickShotTimers(jobs, n, TUNE(HEXA_SHOOT_INTERVAL));
+    for (int k = 0; k < fired; k++) {
+        Enemy *e = &g.enemies[jobs[k].enemy];
+        Vector2 shootDir = Vector2Scale(jobs[k].toTarget, 1.0f / jobs[k].dist);
+        EmitPattern(PAT_HEXA_FAN, e->pos, shootDir, e->size + MUZZLE_OFFSET);
         Vector2 muzzle = Vector2Add(e->pos,
             Vector2Scale(shootDir, e->size + MUZZLE_OFFSET));
         SpawnParticle(muzzle,
@@ -83,7 +77,9 @@ static void ShootHexa(Enemy *e, Vector2 toTarget, float dist, float dt) {
     }
 }
 
-static void ShootTrap(Enemy *e, Vector2 toTarget, float dist, float dt) {
+// bosses are one or two at a time with a lot of per-enemy state, they keep
+// the per-enemy attack logic and just get looped over
+static void TrapAttack(Enemy *e, Vector2 toTarget, float dist, float dt) {
     if (e->chargeTimer > 0) return;
     e->shootTimer -= dt;
     if (e->shootTimer <= 0 && dist > 1.0f) {
@@ -92,20 +88,8 @@ static void ShootTrap(Enemy *e, Vector2 toTarget, float dist, float dt) {
         case 0: { // Aimed burst — cone at player
             Vector2 shootDir = Vector2Scale(
                 toTarget, 1.0f / dist);
-            float baseAngle = atan2f(shootDir.y, shootDir.x);
-            float halfSpread = TRAP_BURST_SPREAD / 2.0f;
-            float step = TRAP_BURST_SPREAD
-                / (TRAP_BURST_COUNT - 1);
-            for (int b = 0; b < TRAP_BURST_COUNT; b++) {
-                float a = baseAngle - halfSpread + step * b;
-                Vector2 dir = { cosf(a), sinf(a) };
-                Vector2 muzzle = Vector2Add(e->pos,
-                    Vector2Scale(dir, e->size + MUZZLE_OFFSET));
-                SpawnProjectile(muzzle, dir,
-                    TRAP_BULLET_SPEED, TRAP_BULLET_DAMAGE,
-                    TRAP_BULLET_LIFETIME, TRAP_PROJECTILE_SIZE,
-                    true, false, PROJ_BULLET, DMG_BALLISTIC);
-            }
+            EmitPattern(PAT_TRAP_BURST, e->pos, shootDir,
+                e->size + MUZZLE_OFFSET);
             Vector2 muzzle = Vector2Add(e->pos,
                 Vector2Scale(shootDir,
                     e->size + MUZZLE_OFFSET));
@@ -115,28 +99,19 @@ static void ShootTrap(Enemy *e, Vector2 toTarget, float dist, float dt) {
                 TRAP_MUZZLE_LIFETIME);
         } break;
         case 1: { // Ring shot — bullets in all directions
-            float step = 2.0f * PI / TRAP_RING_COUNT;
-            for (int b = 0; b < TRAP_RING_COUNT; b++) {
-                float a = step * b;
-                Vector2 dir = { cosf(a), sinf(a) };
-                Vector2 muzzle = Vector2Add(e->pos,
-                    Vector2Scale(dir, e->size + MUZZLE_OFFSET));
-                SpawnProjectile(muzzle, dir,
-                    TRAP_RING_SPEED, TRAP_RING_DAMAGE,
-                    TRAP_BULLET_LIFETIME, TRAP_PROJECTILE_SIZE,
-                    true, false, PROJ_BULLET, DMG_BALLISTIC);
-            }
+            EmitPattern(PAT_TRAP_RING, e->pos, (Vector2){ 1, 0 },
+                e->size + MUZZLE_OFFSET);
             SpawnParticles(e->pos, TRAP_COLOR, 12);
         } break;
         case 2: { // Charge at player
             Vector2 shootDir = Vector2Scale(
                 toTarget, 1.0f / dist);
             e->chargeDir = shootDir;
-            e->chargeTimer = TRAP_CHARGE_DURATION;
+            e->chargeTimer = TUNE(TRAP_CHARGE_DURATION);
         } break;
         }
         e->attackPhase++;
-        e->shootTimer = TRAP_ATTACK_INTERVAL;
+        e->shootTimer = TUNE(TRAP_ATTACK_INTERVAL);
     }
 }
 
@@ -146,29 +121,29 @@ static void CircFireWeapon(
 {
     switch (wpn) {
     case WPN_GUN: {
-        e->burstTimer = CIRC_GUN_BURST_DURATION;
+        e->burstTimer = TUNE(CIRC_GUN_BURST_DURATION);
         e->burstCooldown = 0;
     } break;
     case WPN_SWORD: {
         e->chargeDir = shootDir;
-        e->chargeTimer = CIRC_SWORD_DASH_DURATION;
+        e->chargeTimer = TUNE(CIRC_SWORD_DASH_DURATION);
         e->sweepTimer = -1;  // flag: start sweep when charge ends
     } break;
     case WPN_REVOLVER: {
-        e->fanRounds = CIRC_REV_COUNT;
+        e->fanRounds = TUNE(CIRC_REV_COUNT);
         e->fanTimer = 0;
         e->fanAngle = baseAngle;
     } break;
     case WPN_SNIPER: {
         SpawnProjectile(muzzle, shootDir,
-            CIRC_SNIPER_SPEED, CIRC_SNIPER_DAMAGE,
-            CIRC_SNIPER_LIFETIME, CIRC_SNIPER_SIZE,
+            TUNE(CIRC_SNIPER_SPEED), TUNE(CIRC_SNIPER_DAMAGE),
+            TUNE(CIRC_SNIPER_LIFETIME), TUNE(CIRC_SNIPER_SIZE),
             true, false, PROJ_BULLET, DMG_BALLISTIC);
     } break;
     case WPN_ROCKET: {
         SpawnProjectile(muzzle, shootDir,
-            CIRC_ROCKET_SPEED, CIRC_ROCKET_DAMAGE,
-            CIRC_ROCKET_LIFETIME, CIRC_ROCKET_SIZE,
+            TUNE(CIRC_ROCKET_SPEED), TUNE(CIRC_ROCKET_DAMAGE),
+            TUNE(CIRC_ROCKET_LIFETIME), TUNE(CIRC_ROCKET_SIZE),
             true, false, PROJ_ROCKET, DMG_EXPLOSIVE);
     } break;
     default: break;
@@ -181,31 +156,24 @@ static void CircFireWeapon(
     }
 }
 
-static void ShootCirc(
+static void CircAttack(
     Enemy *e, Vector2 toTarget, float dist, float dt)
 {
     if (e->chargeTimer > 0) return;
     // Sword sweep — damage player if swept edge reaches them
     if (e->sweepTimer > 0) {
-        float progress = 1.0f - (e->sweepTimer / CIRC_SWORD_DURATION);
+        float progress = 1.0f - (e->sweepTimer / TUNE(CIRC_SWORD_DURATION));
         e->sweepTimer -= dt;
-        float newProgress = 1.0f - (e->sweepTimer / CIRC_SWORD_DURATION);
+        float newProgress = 1.0f - (e->sweepTimer / TUNE(CIRC_SWORD_DURATION));
         if (newProgress > 1.0f) newProgress = 1.0f;
-        float dist2 = Vector2Distance(e->pos, g.player.pos);
-        if (dist2 < CIRC_SWORD_RADIUS + g.player.size) {
-            Vector2 toP = Vector2Subtract(g.player.pos, e->pos);
-            float pAngle = atan2f(toP.y, toP.x);
-            float diff = fmodf(pAngle - e->sweepAngle + 3*PI,
-                2*PI) - PI;
-            // Sweep goes from -arc/2 to +arc/2 over duration
-            float sweepStart = -CIRC_SWORD_ARC / 2.0f
-                + CIRC_SWORD_ARC * progress;
-            float sweepEnd = -CIRC_SWORD_ARC / 2.0f
-                + CIRC_SWORD_ARC * newProgress;
-            if (diff >= sweepStart && diff <= sweepEnd)
-                DamagePlayer(CIRC_SWORD_DAMAGE, DMG_SLASH,
-                    HIT_MELEE);
-        }
+        // Sweep goes from -arc/2 to +arc/2 over duration, this tick
+        // covers the wedge between the old and new progress
+        float sweepStart = e->sweepAngle - CIRC_SWORD_ARC / 2.0f;
+        ArcSector swept = MakeArcBetween(e->pos,
+            sweepStart + CIRC_SWORD_ARC * progress,
+            sweepStart + CIRC_SWORD_ARC * newProgress, TUNE(CIRC_SWORD_RADIUS));
+        if (InArc(&swept, g.player.pos, g.player.size))
+            DamagePlayer(TUNE(CIRC_SWORD_DAMAGE), DMG_SLASH, HIT_MELEE);
         if (e->sweepTimer <= 0) SpawnParticles(e->pos, WHITE, 8);
         return;
     }
@@ -213,20 +181,20 @@ static void ShootCirc(
     if (e->fanRounds > 0) {
         e->fanTimer -= dt;
         if (e->fanTimer <= 0) {
-            float spread = ((float)GetRandomValue(
-                -CIRC_REV_SPREAD, CIRC_REV_SPREAD)) * 0.001f;
+            float spread = ((float)SimRandom(
+                -TUNE(CIRC_REV_SPREAD), TUNE(CIRC_REV_SPREAD))) * 0.001f;
             float a = e->fanAngle + spread;
             Vector2 dir = { cosf(a), sinf(a) };
             Vector2 m = Vector2Add(e->pos,
                 Vector2Scale(dir, e->size + MUZZLE_OFFSET));
-            SpawnProjectile(m, dir, CIRC_REV_SPEED,
-                CIRC_REV_DAMAGE, CIRC_REV_LIFETIME,
-                CIRC_REV_SIZE, true, false,
+            SpawnProjectile(m, dir, TUNE(CIRC_REV_SPEED),
+                TUNE(CIRC_REV_DAMAGE), TUNE(CIRC_REV_LIFETIME),
+                TUNE(CIRC_REV_SIZE), true, false,
                 PROJ_BULLET, DMG_BALLISTIC);
             SpawnParticle(m, Vector2Scale(dir, ENEMY_MUZZLE_SPEED),
                 CIRC_COLOR, CIRC_MUZZLE_SIZE, CIRC_MUZZLE_LIFETIME);
             e->fanRounds--;
-            e->fanTimer = CIRC_REV_FAN_COOLDOWN;
+            e->fanTimer = TUNE(CIRC_REV_FAN_COOLDOWN);
         }
         return;
     }
@@ -237,19 +205,19 @@ static void ShootCirc(
         if (e->burstCooldown <= 0) {
             Vector2 toP = Vector2Subtract(g.player.pos, e->pos);
             float aimAngle = atan2f(toP.y, toP.x);
-            float spread = ((float)GetRandomValue(
-                -CIRC_GUN_SPREAD, CIRC_GUN_SPREAD)) * 0.001f;
+            float spread = ((float)SimRandom(
+                -TUNE(CIRC_GUN_SPREAD), TUNE(CIRC_GUN_SPREAD))) * 0.001f;
             float a = aimAngle + spread;
             Vector2 dir = { cosf(a), sinf(a) };
             Vector2 m = Vector2Add(e->pos,
                 Vector2Scale(dir, e->size + MUZZLE_OFFSET));
-            SpawnProjectile(m, dir, CIRC_GUN_SPEED,
-                CIRC_GUN_DAMAGE, CIRC_GUN_LIFETIME,
-                CIRC_GUN_SIZE, true, false,
+            SpawnProjectile(m, dir, TUNE(CIRC_GUN_SPEED),
+                TUNE(CIRC_GUN_DAMAGE), TUNE(CIRC_GUN_LIFETIME),
+                TUNE(CIRC_GUN_SIZE), true, false,
                 PROJ_BULLET, DMG_BALLISTIC);
             SpawnParticle(m, Vector2Scale(dir, ENEMY_MUZZLE_SPEED),
                 CIRC_COLOR, CIRC_MUZZLE_SIZE, CIRC_MUZZLE_LIFETIME);
-            e->burstCooldown = CIRC_GUN_FIRE_RATE;
+            e->burstCooldown = TUNE(CIRC_GUN_FIRE_RATE);
         }
         return;
     }
@@ -270,29 +238,18 @@ static void ShootCirc(
         Vector2 muzzle = Vector2Add(e->pos,
             Vector2Scale(shootDir, e->size + MUZZLE_OFFSET));
 
-        int pattern = GetRandomValue(0, 7);
+        int pattern = SimRandom(0, 7);
         switch (pattern) {
         case 0: case 2: case 4: {
             // Unchosen weapon attack
-            int idx = GetRandomValue(0, wcount - 1);
+            int idx = SimRandom(0, wcount - 1);
             CircFireWeapon(e, weapons[idx],
                 shootDir, baseAngle, muzzle);
         } break;
         case 1: {
             // Ring wave
-            float step = 2.0f * PI / CIRC_RING_COUNT;
-            for (int b = 0; b < CIRC_RING_COUNT; b++) {
-                float a = step * b;
-                Vector2 dir = { cosf(a), sinf(a) };
-                Vector2 m = Vector2Add(e->pos,
-                    Vector2Scale(dir,
-                        e->size + MUZZLE_OFFSET));
-                SpawnProjectile(m, dir,
-                    CIRC_RING_SPEED, CIRC_RING_DAMAGE,
-                    CIRC_RING_LIFETIME, CIRC_RING_SIZE,
-                    true, false, PROJ_BULLET,
-                    DMG_BALLISTIC);
-            }
+            EmitPattern(PAT_CIRC_RING, e->pos, (Vector2){ 1, 0 },
+                e->size + MUZZLE_OFFSET);
             SpawnParticles(e->pos, CIRC_COLOR, 12);
         } break;
         case 3: {
@@ -302,51 +259,16 @@ static void ShootCirc(
         } break;
         case 5: {
             // Spiral burst
-            float time = (float)GetTime();
-            for (int arm = 0; arm < CIRC_SPIRAL_ARMS;
-                arm++) {
-                float armAngle = 2.0f * PI * arm
-                    / CIRC_SPIRAL_ARMS + time;
-                for (int b = 0; b < CIRC_SPIRAL_PER_ARM;
-                    b++) {
-                    float a = armAngle + b * 0.3f;
-                    Vector2 dir = { cosf(a), sinf(a) };
-                    Vector2 m = Vector2Add(e->pos,
-                        Vector2Scale(dir,
-                            e->size + MUZZLE_OFFSET));
-                    SpawnProjectile(m, dir,
-                        CIRC_SPIRAL_SPEED,
-                        CIRC_SPIRAL_DAMAGE,
-                        CIRC_SPIRAL_LIFETIME,
-                        CIRC_SPIRAL_SIZE,
-                        true, false, PROJ_BULLET,
-                        DMG_BALLISTIC);
-                }
-            }
+            // the whole spiral turns with sim time
+            EmitPattern(PAT_CIRC_SPIRAL, e->pos,
+                (Vector2){ cosf(g.time), sinf(g.time) },
+                e->size + MUZZLE_OFFSET);
             SpawnParticles(e->pos, CIRC_COLOR, 8);
         } break;
         case 6: {
             // Shotgun blast at player
-            float halfSpread =
-                CIRC_SHOTGUN_SPREAD / 2.0f;
-            float step = CIRC_SHOTGUN_SPREAD
-                / (CIRC_SHOTGUN_PELLETS - 1);
-            for (int b = 0; b < CIRC_SHOTGUN_PELLETS;
-                b++) {
-                float a = baseAngle - halfSpread
-                    + step * b;
-                Vector2 dir = { cosf(a), sinf(a) };
-                Vector2 m = Vector2Add(e->pos,
-                    Vector2Scale(dir,
-                        e->size + MUZZLE_OFFSET));
-                SpawnProjectile(m, dir,
-                    CIRC_SHOTGUN_SPEED,
-                    CIRC_SHOTGUN_DAMAGE,
-                    CIRC_SHOTGUN_LIFETIME,
-                    CIRC_SHOTGUN_SIZE,
-                    true, true, PROJ_BULLET,
-                    DMG_BALLISTIC);
-            }
+            EmitPattern(PAT_CIRC_SHOTGUN, e->pos, shootDir,
+                e->size + MUZZLE_OFFSET);
             SpawnParticle(muzzle,
                 Vector2Scale(shootDir,
                     ENEMY_MUZZLE_SPEED),
@@ -357,62 +279,91 @@ static void ShootCirc(
             // Ground slam AoE (damages player nearby)
             float playerDist = Vector2Distance(
                 e->pos, g.player.pos);
-            if (playerDist <= SLAM_RANGE) {
-                DamagePlayer(CIRC_SLAM_DAMAGE,
+            if (playerDist <= TUNE(SLAM_RANGE)) {
+                DamagePlayer(TUNE(CIRC_SLAM_DAMAGE),
                     DMG_BLUNT, HIT_AOE);
             }
             // Ring of bullets outward after slam
-            float step = 2.0f * PI / CIRC_RING_COUNT;
-            for (int b = 0; b < CIRC_RING_COUNT; b++) {
-                float a = step * b;
-                Vector2 dir = { cosf(a), sinf(a) };
-                Vector2 m = Vector2Add(e->pos,
-                    Vector2Scale(dir,
-                        e->size + MUZZLE_OFFSET));
-                SpawnProjectile(m, dir,
-                    CIRC_RING_SPEED, CIRC_RING_DAMAGE,
-                    CIRC_RING_LIFETIME, CIRC_RING_SIZE,
-                    true, false, PROJ_BULLET,
-                    DMG_BALLISTIC);
-            }
+            EmitPattern(PAT_CIRC_RING, e->pos, (Vector2){ 1, 0 },
+                e->size + MUZZLE_OFFSET);
             SpawnParticles(e->pos, CIRC_COLOR, 16);
         } break;
         }
-        e->shootTimer = CIRC_ATTACK_INTERVAL;
+        e->shootTimer = TUNE(CIRC_ATTACK_INTERVAL);
     }
 }
 
+static void ShootTrap(ShotJob *jobs, int n) {
+    for (int k = 0; k < n; k++)
+        TrapAttack(&g.enemies[jobs[k].enemy],
+            jobs[k].toTarget, jobs[k].dist, jobs[k].dt);
+}
+
+static void ShootCirc(ShotJob *jobs, int n) {
+    for (int k = 0; k < n; k++)
+        CircAttack(&g.enemies[jobs[k].enemy],
+            jobs[k].toTarget, jobs[k].dist, jobs[k].dt);
+}
+
 // enemy definitions — one row per type
 const EnemyDef ENEMY_DEFS[] = {
 //              size         hp        spdMin            spdVar
-//              contactDmg   spnKills  gold
-//              value        shoot
+//              contactDmg   spnKills
+//              gold        value        mass         shoot
     [TRI]   = { TRI_SIZE,    TRI_HP,   TRI_SPEED_MIN,   TRI_SPEED_VAR,
                 TRI_CONTACT_DAMAGE,    0,
-                TRI_GOLD,   TRI_VALUE,   NULL },
+                TRI_GOLD,   TRI_VALUE,   TRI_MASS,    NULL },
     [RECT]  = { RECT_SIZE,   RECT_HP,  RECT_SPEED_MIN,  RECT_SPEED_VAR,
                 RECT_CONTACT_DAMAGE,   RECT_SPAWN_KILLS,
-                RECT_GOLD,  RECT_VALUE,  ShootRect },
+                RECT_GOLD,  RECT_VALUE,  RECT_MASS,   ShootRect },
     [PENTA] = { PENTA_SIZE,  PENTA_HP, PENTA_SPEED_MIN, PENTA_SPEED_VAR,
                 PENTA_CONTACT_DAMAGE,  PENTA_SPAWN_KILLS,
-                PENTA_GOLD, PENTA_VALUE, ShootPenta },
+                PENTA_GOLD, PENTA_VALUE, PENTA_MASS,  ShootPenta },
     [RHOM]  = { RHOM_SIZE,   RHOM_HP,  RHOM_SPEED_MIN,  RHOM_SPEED_VAR,
                 RHOM_CONTACT_DAMAGE,   RHOM_SPAWN_KILLS,
-                RHOM_GOLD,  RHOM_VALUE,  NULL },
+                RHOM_GOLD,  RHOM_VALUE,  RHOM_MASS,   NULL },
     [HEXA]  = { HEXA_SIZE,   HEXA_HP,  HEXA_SPEED_MIN,  HEXA_SPEED_VAR,
                 HEXA_CONTACT_DAMAGE,   HEXA_SPAWN_KILLS,
-                HEXA_GOLD,  HEXA_VALUE,  ShootHexa },
+                HEXA_GOLD,  HEXA_VALUE,  HEXA_MASS,   ShootHexa },
     [OCTA]  = { OCTA_SIZE,   OCTA_HP,  OCTA_SPEED_MIN,  OCTA_SPEED_VAR,
                 OCTA_CONTACT_DAMAGE,   OCTA_SPAWN_KILLS,
-                OCTA_GOLD,  OCTA_VALUE,  NULL },
+                OCTA_GOLD,  OCTA_VALUE,  OCTA_MASS,   NULL },
     [TRAP]  = { TRAP_SIZE,   TRAP_HP,  TRAP_SPEED_MIN,  TRAP_SPEED_VAR,
                 TRAP_CONTACT_DAMAGE,   TRAP_SPAWN_KILLS,
-                TRAP_GOLD,  TRAP_VALUE,  ShootTrap },
+                TRAP_GOLD,  TRAP_VALUE,  TRAP_MASS,   ShootTrap },
     [CIRC]  = { CIRC_SIZE,   CIRC_HP,  CIRC_SPEED_MIN,  CIRC_SPEED_VAR,
                 CIRC_CONTACT_DAMAGE,   0,
-                CIRC_GOLD,  CIRC_VALUE,  ShootCirc },
+                CIRC_GOLD,  CIRC_VALUE,  CIRC_MASS,   ShootCirc },
 };
 
+// shot queue -------------------------------------------------------------- /
+void QueueEnemyShot(int enemy, Vector2 toTarget, float dist, float dt)
+{
+    shotQueue[shotCount++] = (ShotJob){ enemy, toTarget, dist, dt };
+}
+
+// bucket the queue by type (counting sort, stable so slot order holds)
+// then run each type's pass once
+void FireEnemyShots(void)
+{
+    int start[ENEMY_TYPE_COUNT + 1] = { 0 };
+    for (int k = 0; k < shotCount; k++)
+        start[g.enemies[shotQueue[k].enemy].type + 1]++;
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++)
+        start[t + 1] += start[t];
+    int fill[ENEMY_TYPE_COUNT];
+    memcpy(fill, start, sizeof(fill));
+    for (int k = 0; k < shotCount; k++)
+        shotSorted[fill[g.enemies[shotQueue[k].enemy].type]++] = shotQueue[k];
+    shotCount = 0;
+
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        int n = start[t + 1] - start[t];
+        if (n > 0 && ENEMY_DEFS[t].shoot)
+            ENEMY_DEFS[t].shoot(shotSorted + start[t], n);
+    }
+}
+
 // Spawn Helpers ------------------------------------------------------------ /
 Projectile* SpawnProjectile(
     Vector2 pos, Vector2 dir,
@@ -420,43 +371,160 @@ Projectile* SpawnProjectile(
     bool isEnemy, bool knockback,
     ProjectileType type, DamageType dmgType)
 {
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (!g.projectiles[i].active) {
-            Projectile *b = &g.projectiles[i];
-            b->active = true;
-            b->pos = pos;
-            b->vel = Vector2Scale(dir, speed);
-            b->lifetime = lifetime;
-            b->size = size;
-            b->damage = damage;
-            b->isEnemy = isEnemy;
-            b->knockback = knockback;
-            b->appliesSlow = false;
-            b->type = type;
-            b->dmgType = dmgType;
-            return b;
+    PoolID pool = isEnemy ? POOL_ENEMY_SHOT : POOL_PLAYER_SHOT;
+    int i = ClaimSlot(pool);
+    if (i < 0) return NULL;
+    Projectile *b = isEnemy ? &g.enemyShots[i] : &g.playerShots[i];
+    b->active = true;
+    b->pos = pos;
+    b->vel = Vector2Scale(dir, speed);
+    b->lifetime = lifetime;
+    b->size = size;
+    b->damage = damage;
+    b->knockback = knockback;
+    b->appliesSlow = false;
+    b->type = type;
+    b->dmgType = dmgType;
+    return b;
+}
+
+// projectile patterns ------------------------------------------------------ /
+// pattern definitions — one row per pattern. the player shotgun isn't here,
+// its numbers are tunables, InitPatterns fills that row from TUNE()
+static const ProjPattern PATTERN_DEFS[PAT_COUNT] = {
+//                    count                  rows  spread
+//                    rowOffset              spacing
+//                    speed                  damage
+//                    lifetime               size
+//                    enemy  kb    bounces   type         dmgType
+    [PAT_PENTA_ROWS] = { PENTA_BULLETS_PER_ROW, 2, 0,
+                        PENTA_ROW_OFFSET * 2, PENTA_BULLET_SPACING,
+                        PENTA_BULLET_SPEED,  PENTA_BULLET_DAMAGE,
+                        PENTA_BULLET_LIFETIME, PENTA_PROJECTILE_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    [PAT_HEXA_FAN]  = { HEXA_FAN_COUNT,      1,    HEXA_FAN_SPREAD,
+                        0,                   0,
+                        HEXA_BULLET_SPEED,   HEXA_BULLET_DAMAGE,
+                        HEXA_BULLET_LIFETIME, HEXA_PROJECTILE_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    [PAT_TRAP_BURST] = { TRAP_BURST_COUNT,   1,    TRAP_BURST_SPREAD,
+                        0,                   0,
+                        TRAP_BULLET_SPEED,   TRAP_BULLET_DAMAGE,
+                        TRAP_BULLET_LIFETIME, TRAP_PROJECTILE_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    [PAT_TRAP_RING] = { TRAP_RING_COUNT,     1,    2.0f * PI,
+                        0,                   0,
+                        TRAP_RING_SPEED,     TRAP_RING_DAMAGE,
+                        TRAP_BULLET_LIFETIME, TRAP_PROJECTILE_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    [PAT_CIRC_RING] = { CIRC_RING_COUNT,     1,    2.0f * PI,
+                        0,                   0,
+                        CIRC_RING_SPEED,     CIRC_RING_DAMAGE,
+                        CIRC_RING_LIFETIME,  CIRC_RING_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    // arms * per-arm, directions are special cased in InitPatterns
+    [PAT_CIRC_SPIRAL] = { CIRC_SPIRAL_ARMS * CIRC_SPIRAL_PER_ARM, 1, 0,
+                        0,                   0,
+                        CIRC_SPIRAL_SPEED,   CIRC_SPIRAL_DAMAGE,
+                        CIRC_SPIRAL_LIFETIME, CIRC_SPIRAL_SIZE,
+                        true,  false, 0,     PROJ_BULLET, DMG_BALLISTIC },
+    [PAT_CIRC_SHOTGUN] = { CIRC_SHOTGUN_PELLETS, 1, CIRC_SHOTGUN_SPREAD,
+                        0,                   0,
+                        CIRC_SHOTGUN_SPEED,  CIRC_SHOTGUN_DAMAGE,
+                        CIRC_SHOTGUN_LIFETIME, CIRC_SHOTGUN_SIZE,
+                        true,  true,  0,     PROJ_BULLET, DMG_BALLISTIC },
+};
+
+// unit directions relative to an aim of +x, rotated onto the real aim at
+// emit time so firing a pattern costs no trig
+static Vector2 patternDirs[PAT_COUNT][PATTERN_MAX_SHOTS];
+static ProjPattern patterns[PAT_COUNT];     // PATTERN_DEFS + the shotgun row
+
+// tuning.c calls this again after every reload so the shotgun row follows
+void InitPatterns(void)
+{
+    memcpy(patterns, PATTERN_DEFS, sizeof(patterns));
+    int pellets = TUNE(SHOTGUN_PELLETS);
+    if (pellets < 1 || pellets > PATTERN_MAX_SHOTS) {
+        TraceLog(LOG_WARNING, "PATTERN: %d shotgun pellets, clamped to 1..%d",
+            pellets, PATTERN_MAX_SHOTS);
+        pellets = pellets < 1 ? 1 : PATTERN_MAX_SHOTS;
+    }
+    patterns[PAT_SHOTGUN] = (ProjPattern){
+        .count = pellets, .rows = 1, .spread = TUNE(SHOTGUN_SPREAD),
+        .speed = TUNE(SHOTGUN_BULLET_SPEED), .damage = TUNE(SHOTGUN_DAMAGE),
+        .lifetime = TUNE(SHOTGUN_BULLET_LIFETIME),
+        .size = SHOTGUN_PROJECTILE_SIZE, .knockback = true,
+        .bounces = SHOTGUN_BOUNCES, .type = PROJ_BULLET,
+        .dmgType = DMG_BALLISTIC,
+    };
+    for (int id = 0; id < PAT_COUNT; id++) {
+        const ProjPattern *pat = &patterns[id];
+        if (pat->count * pat->rows > PATTERN_MAX_SHOTS)
+            TraceLog(LOG_FATAL, "PATTERN: %d has %d shots, max %d",
+                id, pat->count * pat->rows, PATTERN_MAX_SHOTS);
+        bool ring = pat->spread >= 2.0f * PI - 0.001f;
+        float step = ring ? pat->spread / pat->count
+            : (pat->count > 1) ? pat->spread / (pat->count - 1) : 0;
+        float start = ring ? 0 : -pat->spread / 2.0f;
+        for (int b = 0; b < pat->count; b++) {
+            float a = start + step * b;
+            patternDirs[id][b] = (Vector2){ cosf(a), sinf(a) };
+        }
+    }
+    // spiral: evenly spaced arms, each bending 0.3 rad per bullet
+    for (int arm = 0; arm < CIRC_SPIRAL_ARMS; arm++) {
+        for (int b = 0; b < CIRC_SPIRAL_PER_ARM; b++) {
+            float a = 2.0f * PI * arm / CIRC_SPIRAL_ARMS + b * 0.3f;
+            patternDirs[PAT_CIRC_SPIRAL][arm * CIRC_SPIRAL_PER_ARM + b] =
+                (Vector2){ cosf(a), sinf(a) };
+        }
+    }
+}
+
+// fires a whole pattern from origin, aim must be a unit vector, muzzle is
+// how far out the first bullet sits. slots are claimed in one scan and land
+// contiguous at the tail when the pool is compact. returns bullets spawned
+int EmitPattern(PatternID id, Vector2 origin, Vector2 aim, float muzzle)
+{
+    const ProjPattern *pat = &patterns[id];
+    const Vector2 *dirs = patternDirs[id];
+    int slots[PATTERN_MAX_SHOTS];
+    int got = ClaimSlots(pat->isEnemy ? POOL_ENEMY_SHOT : POOL_PLAYER_SHOT,
+        pat->count * pat->rows, slots);
+    Projectile *pool = pat->isEnemy ? g.enemyShots : g.playerShots;
+    Vector2 perp = { -aim.y, aim.x };
+
+    int k = 0;
+    for (int r = 0; r < pat->rows; r++) {
+        float off = (r - (pat->rows - 1) * 0.5f) * pat->rowOffset;
+        Vector2 rowOrigin = Vector2Add(origin, Vector2Scale(perp, off));
+        for (int b = 0; b < pat->count && k < got; b++, k++) {
+            // rotate the table direction onto the aim
+            Vector2 d = dirs[b];
+            Vector2 dir = { d.x * aim.x - d.y * aim.y,
+                            d.x * aim.y + d.y * aim.x };
+            pool[slots[k]] = (Projectile){
+                .pos = Vector2Add(rowOrigin,
+                    Vector2Scale(dir, muzzle + b * pat->spacing)),
+                .vel = Vector2Scale(dir, pat->speed),
+                .lifetime = pat->lifetime,
+                .size = pat->size,
+                .type = pat->type,
+                .dmgType = pat->dmgType,
+                .damage = pat->damage,
+                .active = true,
+                .knockback = pat->knockback,
+                .bounces = pat->bounces,
+            };
         }
     }
-    return NULL;
+    return got;
 }
 
 void FireShotgunBlast(Player *p, Vector2 toMouse) {
     Vector2 aimDir = Vector2Normalize(toMouse);
-    float baseAngle = atan2f(aimDir.y, aimDir.x);
-    float halfSpread = SHOTGUN_SPREAD / 2.0f;
-    float step = SHOTGUN_SPREAD / (SHOTGUN_PELLETS - 1);
-
-    for (int i = 0; i < SHOTGUN_PELLETS; i++) {
-        float angle = baseAngle - halfSpread + step * i;
-        Vector2 dir = { cosf(angle), sinf(angle) };
-        Vector2 muzzle = Vector2Add(p->pos,
-            Vector2Scale(dir, p->size + MUZZLE_OFFSET));
-        Projectile *pellet = SpawnProjectile(muzzle, dir,
-            SHOTGUN_BULLET_SPEED, SHOTGUN_DAMAGE,
-            SHOTGUN_BULLET_LIFETIME, SHOTGUN_PROJECTILE_SIZE, false, true,
-            PROJ_BULLET, DMG_BALLISTIC);
-        if (pellet) pellet->bounces = SHOTGUN_BOUNCES;
-    }
+    EmitPattern(PAT_SHOTGUN, p->pos, aimDir, p->size + MUZZLE_OFFSET);
 
     Vector2 muzzle = Vector2Add(p->pos,
         Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
@@ -471,8 +539,8 @@ void SpawnRocket(Player *p, Vector2 toMouse) {
     Vector2 muzzle = Vector2Add(p->pos,
         Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
     Projectile *r = SpawnProjectile(muzzle, aimDir,
-        ROCKET_SPEED, ROCKET_DIRECT_DAMAGE,
-        ROCKET_LIFETIME, ROCKET_PROJECTILE_SIZE, false, true,
+        TUNE(ROCKET_SPEED), TUNE(ROCKET_DIRECT_DAMAGE),
+        TUNE(ROCKET_LIFETIME), TUNE(ROCKET_PROJECTILE_SIZE), false, true,
         PROJ_ROCKET, DMG_EXPLOSIVE);
     (void)r;
     // muzzle flash
@@ -490,13 +558,13 @@ void SpawnGrenade(Player *p, Vector2 toMouse) {
     Vector2 muzzle = Vector2Add(p->pos,
         Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
     Projectile *gr = SpawnProjectile(muzzle, aimDir,
-        GRENADE_SPEED, GRENADE_DIRECT_DAMAGE,
-        GRENADE_LIFETIME, GRENADE_PROJECTILE_SIZE, false, true,
+        TUNE(GRENADE_SPEED), TUNE(GRENADE_DIRECT_DAMAGE),
+        TUNE(GRENADE_LIFETIME), TUNE(GRENADE_PROJECTILE_SIZE), false, true,
         PROJ_GRENADE, DMG_EXPLOSIVE);
     if (gr) {
-        gr->bounces = GRENADE_MAX_BOUNCES;
+        gr->bounces = TUNE(GRENADE_MAX_BOUNCES);
         gr->height = 0.0f;
-        gr->heightVel = GRENADE_LAUNCH_HEIGHT_VEL;
+        gr->heightVel = TUNE(GRENADE_LAUNCH_HEIGHT_VEL);
     }
     // muzzle flash
     SpawnParticles(muzzle, GRENADE_GLOW_COLOR, GRENADE_MUZZLE_PARTICLES);
@@ -508,13 +576,16 @@ void SpawnGrenade(Player *p, Vector2 toMouse) {
 // spawn helpers ------------------------------------------------------------- /
 static void InitEnemy(Enemy *e) {
     e->active = true;
+    e->gen = NEXT_GEN(e->gen);
     e->hitFlash = 0;
     e->shootTimer = 0;
     e->slowTimer = 0;
     e->slowFactor = 1.0f;
     e->rootTimer = 0;
     e->stunTimer = 0;
-    e->aggroIdx = -1;
+    e->aggro = HANDLE_NONE;
+    // alternate by spawn slot, stored so compaction can't flip it later
+    e->strafeSign = ((e - g.enemies) % 2 == 0) ? 1 : -1;
     e->attackPhase = 0;
     e->chargeTimer = 0;
     e->chargeDir = (Vector2){ 0, 0 };
@@ -522,16 +593,16 @@ static void InitEnemy(Enemy *e) {
 }
 
 static void SpawnAtEdge(Enemy *e) {
-    int edge = GetRandomValue(0, 3);
+    int edge = SimRandom(0, 3);
     switch (edge) {
-        case 0: e->pos.x = (float)GetRandomValue((int)MAP_LEFT, (int)MAP_RIGHT);
-                e->pos.y = g.player.pos.y - SPAWN_MARGIN; break;
-        case 1: e->pos.x = (float)GetRandomValue((int)MAP_LEFT, (int)MAP_RIGHT);
-                e->pos.y = g.player.pos.y + SPAWN_MARGIN; break;
-        case 2: e->pos.x = g.player.pos.x - SPAWN_MARGIN;
-                e->pos.y = (float)GetRandomValue(0, (int)MAP_SIZE); break;
-        case 3: e->pos.x = g.player.pos.x + SPAWN_MARGIN;
-                e->pos.y = (float)GetRandomValue(0, (int)MAP_SIZE); break;
+        case 0: e->pos.x = (float)SimRandom((int)MAP_LEFT, (int)MAP_RIGHT);
+                e->pos.y = g.player.pos.y - TUNE(SPAWN_MARGIN); break;
+        case 1: e->pos.x = (float)SimRandom((int)MAP_LEFT, (int)MAP_RIGHT);
+                e->pos.y = g.player.pos.y + TUNE(SPAWN_MARGIN); break;
+        case 2: e->pos.x = g.player.pos.x - TUNE(SPAWN_MARGIN);
+                e->pos.y = (float)SimRandom(0, (int)MAP_SIZE); break;
+        case 3: e->pos.x = g.player.pos.x + TUNE(SPAWN_MARGIN);
+                e->pos.y = (float)SimRandom(0, (int)MAP_SIZE); break;
     }
     e->pos = Vector2Clamp(e->pos,
         (Vector2){MAP_LEFT, 0}, (Vector2){MAP_RIGHT, MAP_SIZE});
@@ -561,26 +632,23 @@ static EnemyType PickEnemyType(void) {
             eligible[count++] = SPAWNABLE[t];
     }
     if (count == 0) return TRI;
-    return eligible[GetRandomValue(0, count - 1)];
+    return eligible[SimRandom(0, count - 1)];
 }
 
 void SpawnPod(int podValue)
 {
     int remaining = podValue;
     while (remaining > 0) {
-        // find a free slot
-        int slot = -1;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
-            if (!g.enemies[i].active) { slot = i; break; }
-        }
-        if (slot < 0) return; // pool full
+        // find a free slot, grows the pool or counts a drop when full
+        int slot = ClaimSlot(POOL_ENEMY);
+        if (slot < 0) return;
 
         EnemyType type = PickEnemyType();
         Enemy *e = &g.enemies[slot];
         InitEnemy(e);
         FillFromDef(e, type);
         e->speed = ENEMY_DEFS[type].speedMin
-            + (float)GetRandomValue(0, ENEMY_DEFS[type].speedVar);
+            + (float)SimRandom(0, ENEMY_DEFS[type].speedVar);
         SpawnAtEdge(e);
         remaining -= e->value;
     }
@@ -588,47 +656,117 @@ void SpawnPod(int podValue)
 
 void SpawnBoss(EnemyType type)
 {
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (!g.enemies[i].active) {
-            Enemy *e = &g.enemies[i];
-            InitEnemy(e);
-            FillFromDef(e, type);
-            e->speed = ENEMY_DEFS[type].speedMin;
-            SpawnAtEdge(e);
-            return;
-        }
-    }
+    int i = ClaimSlot(POOL_ENEMY);
+    if (i < 0) return;
+    Enemy *e = &g.enemies[i];
+    InitEnemy(e);
+    FillFromDef(e, type);
+    e->speed = ENEMY_DEFS[type].speedMin;
+    SpawnAtEdge(e);
+}
+
+// sim rng ------------------------------------------------------------------ /
+// every gameplay roll goes through here. the state lives in g, so it's in
+// the snapshot and a restored or lockstepped sim rolls the same numbers
+static u32 SimNext(void)
+{
+    u32 x = g.rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return g.rng = x;
+}
+
+// same inclusive range as GetRandomValue
+int SimRandom(int min, int max)
+{
+    if (max < min) { int t = min; min = max; max = t; }
+    return min + (int)(SimNext() % (u32)(max - min + 1));
+}
+
+// particles ---------------------------------------------------------------- /
+// cosmetic rng, separate from the sim's so the governor thinning spawns (and
+// anything else visual) never shifts the gameplay random stream
+static u32 vfxRng = 0x9e3779b9u;
+
+static u32 VfxNext(void)
+{
+    vfxRng ^= vfxRng << 13;
+    vfxRng ^= vfxRng >> 17;
+    vfxRng ^= vfxRng << 5;
+    return vfxRng;
+}
+
+// same inclusive range as GetRandomValue
+int VfxRandom(int min, int max)
+{
+    if (max < min) { int t = min; min = max; max = t; }
+    return min + (int)(VfxNext() % (u32)(max - min + 1));
+}
+
+static float VfxRandf(void)
+{
+    return (float)(VfxNext() >> 8) * (1.0f / 16777216.0f);
+}
+
+// once a frame with the raw frame time. over budget the spawn share drops
+// fast, under it creeps back, so density gives way before frame rate does
+void GovernParticles(float frameTime)
+{
+    VfxState *v = &g.vfx;
+    v->frameTime += (frameTime - v->frameTime) * PARTICLE_GOVERN_SMOOTH;
+    if (v->frameTime > PARTICLE_FRAME_BUDGET)
+        v->particleScale -= PARTICLE_GOVERN_DROP * frameTime;
+    else
+        v->particleScale += PARTICLE_GOVERN_RECOVER * frameTime;
+    if (v->particleScale < PARTICLE_SCALE_MIN)
+        v->particleScale = PARTICLE_SCALE_MIN;
+    if (v->particleScale > 1.0f) v->particleScale = 1.0f;
+}
+
+// ring claim, a full pool recycles the oldest particle instead of dropping
+static void EmitParticle(
+    Vector2 pos, Vector2 vel,
+    Color color, float size, float lifetime)
+{
+    if (lifetime <= 0) return;
+    ParticleStore *ps = &g.vfx.particles;
+    int i = ClaimRingSlot(POOL_PARTICLE);
+    ps->active[i]   = true;
+    ps->pos[i]      = pos;
+    ps->vel[i]      = vel;
+    ps->color[i]    = color;
+    ps->size[i]     = size;
+    ps->lifetime[i] = lifetime;
+    ps->invLife[i]  = 1.0f / lifetime;
 }
 
 // particles will have diff properties of size, angle and speed eventually
+// single spawns (trails, sparks) get thinned by the governor one by one
 void SpawnParticle(
     Vector2 pos, Vector2 vel,
     Color color, float size, float lifetime)
 {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!g.vfx.particles[i].active) {
-            g.vfx.particles[i].active = true;
-            g.vfx.particles[i].pos = pos;
-            g.vfx.particles[i].vel = vel;
-            g.vfx.particles[i].color = color;
-            g.vfx.particles[i].size = size;
-            g.vfx.particles[i].lifetime = lifetime;
-            g.vfx.particles[i].maxLifetime = lifetime;
-            return;
-        }
-    }
+    if (g.vfx.particleScale < 1.0f && VfxRandf() >= g.vfx.particleScale)
+        return;
+    EmitParticle(pos, vel, color, size, lifetime);
 }
 
+// bursts scale their count up front, the fraction rounds stochastically so
+// a 3 particle hit still shows something at low scale
 void SpawnParticles(Vector2 pos, Color color, int count)
 {
+    float scaled = (float)count * g.vfx.particleScale;
+    count = (int)scaled;
+    if (VfxRandf() < scaled - (float)count) count++;
     for (int i = 0; i < count; i++) {
-        float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
-        float speed = (float)GetRandomValue(
+        float angle = (float)VfxRandom(0, 360) * DEG2RAD;
+        float speed = (float)VfxRandom(
             PARTICLE_BURST_SPEED_MIN, PARTICLE_BURST_SPEED_MAX);
         Vector2 vel = { cosf(angle) * speed, sinf(angle) * speed };
-        float size = (float)GetRandomValue(
+        float size = (float)VfxRandom(
             PARTICLE_BURST_SIZE_MIN, PARTICLE_BURST_SIZE_MAX);
-        SpawnParticle(pos, vel, color, size, PARTICLE_BURST_LIFETIME);
+        EmitParticle(pos, vel, color, size, PARTICLE_BURST_LIFETIME);
     }
 }
 
@@ -667,8 +805,8 @@ void DamageEnemy(int idx, int damage, DamageType dmgType, DamageMethod method)
     // charge BFG from damage dealt (only when not active)
     if (!g.player.bfg.active) {
         g.player.bfg.charge += damage;
-        if (g.player.bfg.charge > BFG_CHARGE_COST)
-            g.player.bfg.charge = BFG_CHARGE_COST;
+        if (g.player.bfg.charge > TUNE(BFG_CHARGE_COST))
+            g.player.bfg.charge = TUNE(BFG_CHARGE_COST);
     }
 
     if (e->hp <= 0) {
@@ -695,9 +833,9 @@ void DamagePlayer(int damage, DamageType dmgType, DamageMethod method)
     Player *p = &g.player;
     if (g.invincible || p->iFrames > 0) return;
     p->hp -= damage;
-    p->iFrames = IFRAME_DURATION;
+    p->iFrames = TUNE(IFRAME_DURATION);
     if (p->blink.cooldown <= 0)
-        p->blink.cooldown = BLINK_COOLDOWN_HIT;
+        p->blink.cooldown = TUNE(BLINK_COOLDOWN_HIT);
     SpawnParticles(p->pos, RED, CONTACT_HIT_PARTICLES);
     if (p->hp <= 0) {
         p->hp = 0;
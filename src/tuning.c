@@ -0,0 +1,241 @@
+// tuning.c
+// the runtime tuning block and where it comes from
+// tuning.bin is a TuningFile header and then the Tuning struct byte for
+// byte. the layout hash covers the type and name of every entry, so a file
+// from a build that added, dropped or reordered one is refused, not misread
+// tuning.txt goes on top, "NAME value" lines, and is watched while running
+#include "game.h"
+#include "blob.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TUNING_MAGIC    0x454e5554u     // "TUNE" in the first four bytes
+
+typedef struct TuningFile {
+    u32 magic;
+    u32 layout;         // BlobHashName of LAYOUT
+    u32 size;           // sizeof(Tuning)
+    u32 _pad;
+} TuningFile;
+
+static const Tuning DEFAULTS = {
+#define TUNABLE(type, name, value) .name = value,
+#include "tuning_table.h"
+#undef TUNABLE
+};
+
+#ifndef TUNING_CONST
+_Alignas(64) Tuning tune = {
+#define TUNABLE(type, name, value) .name = value,
+#include "tuning_table.h"
+#undef TUNABLE
+};
+#endif
+
+// name lookup for the text file, every entry is a 4 byte int or float
+static const struct {
+    const char *name;
+    bool isInt;
+    u16 offset;
+} FIELDS[] = {
+#define TUNABLE(type, name, value) \
+    { #name, _Generic(DEFAULTS.name, int: true, default: false), \
+      offsetof(Tuning, name) },
+#include "tuning_table.h"
+#undef TUNABLE
+};
+#define FIELD_COUNT ((int)(sizeof(FIELDS) / sizeof(FIELDS[0])))
+_Static_assert(sizeof(Tuning) == FIELD_COUNT * 4, "tunables are 4 bytes");
+
+static const char LAYOUT[] =
+#define TUNABLE(type, name, value) #type " " #name "\n"
+#include "tuning_table.h"
+#undef TUNABLE
+    "";
+
+static bool ApplyTuning(const u8 *data, int len, const char *from)
+{
+    TuningFile h;
+    if (len < (int)(sizeof(h) + sizeof(Tuning))) return false;
+    memcpy(&h, data, sizeof(h));
+    if (h.magic != TUNING_MAGIC || h.layout != BlobHashName(LAYOUT)
+        || h.size != sizeof(Tuning)) {
+        TraceLog(LOG_WARNING, "TUNE: %s is from another build, "
+            "./mecha --save-tuning makes a fresh one", from);
+        return false;
+    }
+#ifdef TUNING_CONST
+    TraceLog(LOG_INFO, "TUNE: constant folded build, %s ignored", from);
+    return false;
+#else
+    memcpy(&tune, data + sizeof(h), sizeof(Tuning));
+    TraceLog(LOG_INFO, "TUNE: loaded %s", from);
+    return true;
+#endif
+}
+
+#ifndef TUNING_CONST
+static Tuning base;         // what tuning.txt goes on top of
+#endif
+
+// a loose file wins over the copy in the asset blob, so a balance pass
+// doesn't need a repack. neither is fine, the defaults are compiled in
+bool LoadTuning(const char *path)
+{
+    bool ok = false;
+    if (FileExists(path)) {
+        int len = 0;
+        u8 *data = LoadFileData(path, &len);
+        ok = data && ApplyTuning(data, len, path);
+        UnloadFileData(data);
+    } else {
+        int len;
+        const u8 *data = AssetData(FindAsset(TUNING_BLOB_NAME), &len);
+        ok = data && ApplyTuning(data, len, "the asset blob");
+    }
+#ifndef TUNING_CONST
+    base = tune;
+#endif
+    return ok;
+}
+
+// the compiled defaults as a tuning.bin, the starting point for tweaking
+bool SaveTuning(const char *path)
+{
+    TuningFile h = {
+        .magic = TUNING_MAGIC,
+        .layout = BlobHashName(LAYOUT),
+        .size = sizeof(Tuning),
+    };
+    u8 buf[sizeof(h) + sizeof(Tuning)];
+    memcpy(buf, &h, sizeof(h));
+    memcpy(buf + sizeof(h), &DEFAULTS, sizeof(Tuning));
+    bool ok = SaveFileData(path, buf, sizeof(buf));
+    TraceLog(ok ? LOG_INFO : LOG_WARNING, "TUNE: %s %s, %d values",
+        ok ? "wrote" : "could not write", path,
+        (int)(sizeof(Tuning) / sizeof(float)));
+    return ok;
+}
+
+// text overlay ------------------------------------------------------------- /
+// tuning.txt, one "NAME value" per line, # starts a comment. a name that
+// isn't listed keeps its base value (tuning.bin or the compiled default), so
+// deleting a line puts it back. PollTuning runs between frames, and a
+// frame is one tick, so a change lands on a tick boundary and a soak run
+// carries on from where it is
+
+static void FormatField(const Tuning *t, int i, char *out, int cap)
+{
+    const u8 *p = (const u8 *)t + FIELDS[i].offset;
+    if (FIELDS[i].isInt) snprintf(out, cap, "%d", *(const int *)p);
+    else snprintf(out, cap, "%g", *(const float *)p);
+}
+
+// the defaults as a tuning.txt with every entry, delete what you don't touch
+bool SaveTuningText(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "# tuning.txt, NAME value, read over tuning.bin while running\n"
+        "# a deleted line goes back to tuning.bin or the compiled default\n");
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        char val[32];
+        FormatField(&DEFAULTS, i, val, sizeof(val));
+        fprintf(f, "%-32s %s\n", FIELDS[i].name, val);
+    }
+    bool ok = fclose(f) == 0;
+    TraceLog(ok ? LOG_INFO : LOG_WARNING, "TUNE: %s %s",
+        ok ? "wrote" : "could not write", path);
+    return ok;
+}
+
+#ifndef TUNING_CONST
+static int FindField(const char *name)
+{
+    for (int i = 0; i < FIELD_COUNT; i++)
+        if (strcmp(FIELDS[i].name, name) == 0) return i;
+    return -1;
+}
+
+// builds the next block from base + text, bad lines are skipped with a
+// warning and the rest still applies
+static void ApplyTuningText(char *text, const char *path)
+{
+    Tuning next = base;
+    int lineNo = 0;
+    for (char *line = text; line; ) {
+        char *end = strchr(line, '\n');
+        if (end) *end = '\0';
+        char *hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        lineNo++;
+        char name[64], val[32], extra[2];
+        int n = sscanf(line, "%63s %31s %1s", name, val, extra);
+        if (n > 0) {
+            int i = FindField(name);
+            char *tail = NULL;
+            u8 *dst = (u8 *)&next + (i >= 0 ? FIELDS[i].offset : 0);
+            if (i >= 0 && n == 2 && FIELDS[i].isInt) {
+                int v = (int)strtol(val, &tail, 10);
+                if (!*tail) memcpy(dst, &v, sizeof(v));
+            } else if (i >= 0 && n == 2) {
+                float v = strtof(val, &tail);
+                if (*tail == 'f') tail++;
+                if (!*tail) memcpy(dst, &v, sizeof(v));
+            }
+            if (!tail || *tail)
+                TraceLog(LOG_WARNING, "TUNE: %s:%d skipped, %s", path, lineNo,
+                    i < 0 ? "unknown name"
+                    : n != 2 ? "expected NAME value"
+                    : FIELDS[i].isInt ? "not an int" : "not a number");
+        }
+        line = end ? end + 1 : NULL;
+    }
+
+    int changed = 0;
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        const u8 *a = (const u8 *)&tune + FIELDS[i].offset;
+        const u8 *b = (const u8 *)&next + FIELDS[i].offset;
+        if (memcmp(a, b, 4) == 0) continue;
+        char from[32], to[32];
+        FormatField(&tune, i, from, sizeof(from));
+        FormatField(&next, i, to, sizeof(to));
+        TraceLog(LOG_INFO, "TUNE: %s %s -> %s", FIELDS[i].name, from, to);
+        changed++;
+    }
+    tune = next;
+    InitPatterns();
+    TraceLog(LOG_INFO, "TUNE: %s applied, %d changed", path, changed);
+}
+#endif
+
+// native loop, before each frame. the file is tiny, so it's read and
+// hashed every TUNING_POLL_INTERVAL instead of trusting mtimes, which only
+// tick once a second. a removed file drops back to the base values
+void PollTuning(void)
+{
+#ifndef TUNING_CONST
+    static double nextPoll;
+    static u32 lastHash;
+    double now = GetTime();
+    if (now < nextPoll) return;
+    nextPoll = now + TUNING_POLL_INTERVAL;
+
+    char *text = FileExists(TUNING_TEXT_PATH)
+        ? LoadFileText(TUNING_TEXT_PATH) : NULL;
+    u32 hash = text ? BlobHashName(text) : 0;
+    if (hash != lastHash) {
+        lastHash = hash;
+        if (text) {
+            ApplyTuningText(text, TUNING_TEXT_PATH);
+        } else {
+            tune = base;
+            InitPatterns();
+            TraceLog(LOG_INFO, "TUNE: %s gone, back to base values",
+                TUNING_TEXT_PATH);
+        }
+    }
+    UnloadFileText(text);
+#endif
+}
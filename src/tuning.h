@@ -0,0 +1,31 @@
+// tuning.h
+// the balance numbers as one struct, loaded at startup (tuning.c) so a
+// tweak is a file edit instead of a rebuild. the list is tuning_table.h
+//
+// TUNE(NAME) reads one. normally that's a load from the global block, one
+// 64 byte aligned struct that the hot loops share. build with TUNING_CONST
+// (./build2.sh o does) and it reads a static const copy of the defaults
+// instead, which the compiler folds back into immediates like the old
+// #defines, and nothing is loaded
+#ifndef TUNING_H
+#define TUNING_H
+
+typedef struct Tuning {
+#define TUNABLE(type, name, value) type name;
+#include "tuning_table.h"
+#undef TUNABLE
+} Tuning;
+
+#ifdef TUNING_CONST
+static const Tuning TUNING_DEFAULTS = {
+#define TUNABLE(type, name, value) .name = value,
+#include "tuning_table.h"
+#undef TUNABLE
+};
+#define TUNE(name)  (TUNING_DEFAULTS.name)
+#else
+extern Tuning tune;
+#define TUNE(name)  (tune.name)
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+// tuning_table.h
+// every runtime tunable: type, name, compiled default. no include guard on
+// purpose, it's an x-macro list, define TUNABLE(type, name, value) and
+// include it wherever the list needs expanding (tuning.h, tuning.c)
+// code reads them as TUNE(NAME), see tuning.h
+// read them through TUNE() where they're used and never copy one into the
+// Player or GameState at init, a copy misses every tuning.txt reload after.
+// live state that starts at a tunable (dash charges, shield hp) is fine,
+// the limit it's checked against still comes from TUNE(). a table that has
+// to be baked (the shotgun's pattern row) is rebuilt from the reload, see
+// InitPatterns in spawn.c
+// enemy stats and enemy projectile patterns stay in default.h, they feed
+// the const ENEMY_DEFS / PATTERN_DEFS tables in spawn.c
+
+// Physics ------------------------------------------------------------------ /
+TUNABLE(float, CAMERA_LERP_RATE,            8.0f)
+TUNABLE(float, ENEMY_VEL_LERP_RATE,         3.0f)
+TUNABLE(float, ENEMY_CONTACT_KNOCKBACK,     200.0f)
+TUNABLE(float, SPAWN_INITIAL_DELAY,         1.0f)
+TUNABLE(float, ENEMY_SEPARATION,            0.5f)    // fraction of overlap resolved per tick
+
+// Mecha -------------------------------------------------------------------- /
+// Player
+TUNABLE(float, PLAYER_SPEED,                300.0f)
+TUNABLE(int,   PLAYER_HP,                   100)
+TUNABLE(float, IFRAME_DURATION,             0.9f)
+TUNABLE(float, PLAYER_ROT_SPEED,            1.0f)
+// Gun
+TUNABLE(float, GUN_FIRE_RATE,               12.0f)
+TUNABLE(float, GUN_BULLET_SPEED,            1200.0f)
+TUNABLE(float, GUN_BULLET_LIFETIME,         2.0f)
+TUNABLE(int,   GUN_BULLET_DAMAGE,           10)
+TUNABLE(float, GUN_PROJECTILE_SIZE,         3.0f)
+TUNABLE(int,   GUN_SPREAD,                  30)
+// Overheat (shared M1/M2 heat resource)
+TUNABLE(float, GUN_HEAT_PER_SHOT,           0.02f)   // M1
+TUNABLE(float, MINIGUN_HEAT_PER_SHOT,       0.004f)  // M2
+TUNABLE(float, GUN_HEAT_DECAY,              0.3f)    // passive heat loss per second
+TUNABLE(float, GUN_HEAT_DECAY_DELAY,        0.4f)    // seconds after last shot before heat decays
+TUNABLE(float, GUN_OVERHEAT_DECAY,          0.5f)    // heat loss/sec while overheated (normal/miss)
+TUNABLE(float, GUN_OVERHEAT_THRESHOLD,      1.0f)    // heat level that triggers overheat
+TUNABLE(float, GUN_OVERHEAT_CLEAR,          0.0f)    // heat must reach this to unlock
+// QTE vent
+TUNABLE(float, GUN_VENT_CURSOR_SPEED,       1.0f)    // cursor sweeps 0->1 in 1/speed seconds
+TUNABLE(float, GUN_VENT_ZONE_MIN,           0.6f)    // earliest sweet spot left edge
+TUNABLE(float, GUN_VENT_ZONE_MAX,           0.78f)   // latest sweet spot left edge (max + width <= 1)
+TUNABLE(float, GUN_VENT_HIT_DECAY,          5.0f)    // heat loss/sec on perfect vent
+TUNABLE(float, GUN_OVERHEAT_DASH_BOOST,     1.4f)    // movespeed multiplier after dash during overheat
+TUNABLE(float, GUN_OVERHEAT_BOOST_DUR,      3.0f)    // seconds the dash-vent movespeed buff lasts
+// Minigun
+TUNABLE(float, MINIGUN_MAX_FIRE_RATE,       40.0f)
+TUNABLE(float, MINIGUN_MIN_FIRE_RATE,       4.0f)
+TUNABLE(float, MINIGUN_SPIN_UP_TIME,        0.8f)
+TUNABLE(float, MINIGUN_SPIN_DOWN_TIME,      1.6f)
+TUNABLE(float, MINIGUN_BULLET_SPEED,        1000.0f)
+TUNABLE(float, MINIGUN_BULLET_LIFETIME,     1.5f)
+TUNABLE(int,   MINIGUN_BULLET_DAMAGE,       6)
+TUNABLE(float, MINIGUN_PROJECTILE_SIZE,     2.5f)
+TUNABLE(int,   MINIGUN_SPREAD_MIN,          20)
+TUNABLE(int,   MINIGUN_SPREAD_MAX,          80)
+TUNABLE(float, MINIGUN_SLOW_FACTOR,         0.25f)
+TUNABLE(float, MINIGUN_SLOW_LINGER,         0.25f)
+// Sword
+TUNABLE(float, SWORD_ARC,                   0.9f * PI)
+TUNABLE(float, SWORD_DURATION,              0.16f)
+TUNABLE(float, SWORD_RADIUS,                120.0f)
+TUNABLE(int,   SWORD_DAMAGE,                25)
+TUNABLE(int,   SWORD_DASH_DAMAGE,           40)
+// Lunge (M2 for sword)
+TUNABLE(float, LUNGE_DURATION,              0.18f)
+TUNABLE(float, LUNGE_RANGE,                 150.0f)
+TUNABLE(float, LUNGE_CONE_HALF,             0.30f)
+TUNABLE(int,   LUNGE_DAMAGE,                30)
+TUNABLE(int,   LUNGE_DASH_DAMAGE,           50)
+TUNABLE(float, LUNGE_SPEED,                 600.0f)
+// Dash
+TUNABLE(float, DASH_SPEED,                  1600.0f)
+TUNABLE(float, DASH_DURATION,               0.2f)
+TUNABLE(float, DASH_COOLDOWN,               2.0f)
+TUNABLE(int,   DASH_MAX_CHARGES,            3)
+TUNABLE(float, DASH_SUPER_WINDOW,           0.12f)
+TUNABLE(float, DECOY_DURATION,              1.6f)
+// Spin
+TUNABLE(float, SPIN_DURATION,               0.32f)
+TUNABLE(float, SPIN_RADIUS,                 120.0f)
+TUNABLE(float, SPIN_COOLDOWN,               2.0f)
+TUNABLE(int,   SPIN_DAMAGE,                 25)
+TUNABLE(float, SPIN_KNOCKBACK,              250.0f)
+TUNABLE(float, SPIN_LIFESTEAL,              0.1f)
+// Shotgun
+TUNABLE(int,   SHOTGUN_PELLETS,             10)
+TUNABLE(float, SHOTGUN_SPREAD,              0.72f)
+TUNABLE(float, SHOTGUN_BULLET_SPEED,        1400.0f)
+TUNABLE(float, SHOTGUN_BULLET_LIFETIME,     0.20f)
+TUNABLE(int,   SHOTGUN_DAMAGE,              10)
+TUNABLE(float, SHOTGUN_KNOCKBACK,           350.0f)
+TUNABLE(float, SHOTGUN_BOUNCE_SPEED,        0.8f)
+TUNABLE(int,   SHOTGUN_BLASTS,              2)
+TUNABLE(float, SHOTGUN_COOLDOWN,            1.5f)
+// Revolver
+TUNABLE(int,   REVOLVER_ROUNDS,             6)
+TUNABLE(int,   REVOLVER_DAMAGE,             22)
+TUNABLE(float, REVOLVER_COOLDOWN,           0.35f)
+TUNABLE(float, REVOLVER_FAN_COOLDOWN,       0.10f)
+TUNABLE(int,   REVOLVER_FAN_SPREAD,         120)
+TUNABLE(float, REVOLVER_RELOAD_TIME,        1.2f)
+TUNABLE(float, REVOLVER_BULLET_SPEED,       1800.0f)
+TUNABLE(float, REVOLVER_BULLET_LIFETIME,    2.0f)
+TUNABLE(float, REVOLVER_PROJECTILE_SIZE,    4.0f)
+TUNABLE(int,   REVOLVER_PRECISE_SPREAD,     8)
+// Active reload
+TUNABLE(float, REVOLVER_RELOAD_SWEET_START, 0.60f)
+TUNABLE(float, REVOLVER_RELOAD_SWEET_END,   0.75f)
+TUNABLE(float, REVOLVER_RELOAD_FAST_TIME,   0.08f)
+TUNABLE(float, REVOLVER_RELOAD_FAIL_PENALTY, 0.5f)
+// Rocket Launcher
+TUNABLE(float, ROCKET_SPEED,                800.0f)
+TUNABLE(float, ROCKET_LIFETIME,             3.0f)
+TUNABLE(int,   ROCKET_DIRECT_DAMAGE,        40)
+TUNABLE(int,   ROCKET_EXPLOSION_DAMAGE,     60)
+TUNABLE(float, ROCKET_EXPLOSION_RADIUS,     160.0f)
+TUNABLE(float, ROCKET_KNOCKBACK,            250.0f)
+TUNABLE(float, ROCKET_COOLDOWN,             0.715f)
+TUNABLE(float, ROCKET_PROJECTILE_SIZE,      6.0f)
+TUNABLE(int,   ROCKET_JUMP_DAMAGE,          4)
+TUNABLE(float, ROCKET_JUMP_FORCE,           800.0f)
+TUNABLE(float, ROCKET_JUMP_FRICTION,        5.0f)
+// Grenade Launcher
+TUNABLE(float, GRENADE_SPEED,               500.0f)
+TUNABLE(float, GRENADE_DRAG,                1.5f)
+TUNABLE(float, GRENADE_LIFETIME,            2.5f)
+TUNABLE(int,   GRENADE_DIRECT_DAMAGE,       35)
+TUNABLE(int,   GRENADE_EXPLOSION_DAMAGE,    60)
+TUNABLE(float, GRENADE_EXPLOSION_RADIUS,    140.0f)
+TUNABLE(float, GRENADE_KNOCKBACK,           200.0f)
+TUNABLE(float, GRENADE_COOLDOWN,            1.5f)
+TUNABLE(float, GRENADE_PROJECTILE_SIZE,     5.0f)
+TUNABLE(int,   GRENADE_MAX_BOUNCES,         2)
+TUNABLE(float, GRENADE_BOUNCE_DAMPING,      0.6f)
+TUNABLE(float, GRENADE_LAUNCH_HEIGHT_VEL,   200.0f)
+TUNABLE(float, GRENADE_ARC_GRAVITY,         500.0f)
+TUNABLE(float, GRENADE_ARC_BOUNCE_DAMPING,  0.5f)
+TUNABLE(float, GRENADE_ARC_MIN_VEL,         20.0f)
+
+// BFG10k ------------------------------------------------------------------- /
+TUNABLE(float, BFG_SPEED,                   600.0f)
+TUNABLE(float, BFG_LIFETIME,                3.0f)
+TUNABLE(float, BFG_PROJECTILE_SIZE,         14.0f)
+TUNABLE(int,   BFG_DIRECT_DAMAGE,           80)
+TUNABLE(float, BFG_CHARGE_COST,             1000.0f)
+TUNABLE(int,   BFG_CHAIN_DAMAGE,            100)
+TUNABLE(float, BFG_CHAIN_RADIUS,            400.0f)
+TUNABLE(float, BFG_HOP_DELAY,               0.1f)
+TUNABLE(float, BFG_ARC_DURATION,            0.4f)
+
+// Shield ------------------------------------------------------------------- /
+TUNABLE(float, SHIELD_ARC,                  PI)      // half circle (180 degrees)
+TUNABLE(float, SHIELD_MAX_HP,               200.0f)
+TUNABLE(float, SHIELD_REGEN_DELAY,          1.5f)    // seconds after lowering before regen starts
+TUNABLE(float, SHIELD_REGEN_RATE,           50.0f)   // hp/sec regeneration
+TUNABLE(float, SHIELD_RADIUS,               60.0f)   // distance from player center
+TUNABLE(float, SHIELD_SLOW_FACTOR,          0.5f)    // movement multiplier while shielding
+TUNABLE(float, SHIELD_BROKEN_COOLDOWN,      2.0f)    // lockout when shield breaks
+
+// Ground Slam -------------------------------------------------------------- /
+TUNABLE(float, SLAM_ARC,                    PI * 0.417f)   // 75 degree cone
+TUNABLE(int,   SLAM_DAMAGE,                 15)
+TUNABLE(float, SLAM_RANGE,                  300.0f)
+TUNABLE(float, SLAM_KNOCKBACK,              250.0f)
+TUNABLE(float, SLAM_STUN_MIN,               0.5f)
+TUNABLE(float, SLAM_STUN_MAX,               2.0f)
+TUNABLE(float, SLAM_COOLDOWN,               6.0f)
+
+// Parry -------------------------------------------------------------------- /
+TUNABLE(float, PARRY_WINDOW,                0.75f)   // active deflect window
+TUNABLE(float, PARRY_COOLDOWN,              4.0f)    // normal cooldown
+TUNABLE(float, PARRY_SUCCESS_COOLDOWN,      2.0f)    // reduced cooldown on success
+TUNABLE(float, PARRY_STUN_DURATION,         2.75f)   // stun applied to enemies on parry
+TUNABLE(float, PARRY_KNOCKBACK,             400.0f)  // knockback on parried contact
+
+// Turret ------------------------------------------------------------------- /
+TUNABLE(float, TURRET_LIFETIME,             1024.0f)
+TUNABLE(float, TURRET_FIRE_RATE,            0.5f)
+TUNABLE(float, TURRET_RANGE,                600.0f)
+TUNABLE(int,   TURRET_DAMAGE,               12)
+TUNABLE(int,   TURRET_HP,                   160)
+TUNABLE(float, TURRET_BULLET_SPEED,         800.0f)
+TUNABLE(float, TURRET_BULLET_LIFETIME,      3.0f)
+TUNABLE(float, TURRET_BULLET_SIZE,          3.0f)
+TUNABLE(float, TURRET_COOLDOWN,             8.0f)
+TUNABLE(float, TURRET_PLACEMENT_DIST,       100.0f)
+TUNABLE(float, TURRET_HIT_RADIUS,           10.0f)   // enemy shots and contact
+
+// Root Mine ---------------------------------------------------------------- /
+TUNABLE(float, MINE_LIFETIME,               1024.0f)
+TUNABLE(float, MINE_TRIGGER_RADIUS,         40.0f)
+TUNABLE(float, MINE_ROOT_RADIUS,            100.0f)
+TUNABLE(float, MINE_ROOT_DURATION,          3.0f)
+TUNABLE(float, MINE_COOLDOWN,               5.0f)
+
+// Healing Field ------------------------------------------------------------ /
+TUNABLE(float, HEAL_LIFETIME,               8.0f)
+TUNABLE(float, HEAL_RADIUS,                 160.0f)
+TUNABLE(float, HEAL_PER_SEC,                15.0f)
+TUNABLE(float, HEAL_COOLDOWN,               15.0f)
+
+// Flamethrower ------------------------------------------------------------- /
+TUNABLE(float, FLAME_FUEL_MAX,              100.0f)
+TUNABLE(float, FLAME_DRAIN_RATE,            40.0f)   // fuel/sec while firing
+TUNABLE(float, FLAME_REGEN_RATE,            12.0f)   // fuel/sec regen
+TUNABLE(float, FLAME_REGEN_DELAY,           1.0f)    // seconds after release before regen starts
+TUNABLE(float, FLAME_SPRAY_INTERVAL,        0.12f)   // seconds between patch spawns
+TUNABLE(float, FLAME_RANGE,                 400.0f)  // max distance patches land from player
+TUNABLE(float, FLAME_SPREAD,                0.35f)   // radians of cone spread (particles only)
+TUNABLE(float, FLAME_SLOW_FACTOR,           0.7f)    // move speed while spraying
+TUNABLE(float, FLAME_PATCH_LIFETIME,        5.0f)    // seconds each ground patch lasts
+TUNABLE(float, FLAME_PATCH_RADIUS,          30.0f)   // damage radius per patch
+TUNABLE(float, FLAME_PATCH_DPS,             30.0f)   // damage per second per patch
+TUNABLE(float, FLAME_PATCH_TICK,            0.2f)    // damage tick interval
+
+// Blink Dagger ------------------------------------------------------------- /
+TUNABLE(float, BLINK_DISTANCE,              480.0f)  // 1.5x dash distance (320)
+TUNABLE(float, BLINK_COOLDOWN,              10.0f)   // base cd when undamaged
+TUNABLE(float, BLINK_COOLDOWN_HIT,          3.0f)    // cd after taking damage
+TUNABLE(int,   BLINK_DAMAGE,                40)
+TUNABLE(float, BLINK_DAMAGE_DELAY,          1.6f)    // seconds before slash damage
+
+// Hitscan weapons ---------------------------------------------------------- /
+// Railgun (press Z, pierce all, long cooldown)
+TUNABLE(int,   RAILGUN_DAMAGE,              200)
+TUNABLE(float, RAILGUN_RANGE,               10000.0f)
+TUNABLE(float, RAILGUN_COOLDOWN,            2.0f)
+TUNABLE(float, RAILGUN_BEAM_DURATION,       0.2f)
+TUNABLE(float, RAILGUN_BEAM_RADIUS,         10.0f)   // hurtbox
+// Sniper (press X, single fast projectile, slows target, long cooldown)
+TUNABLE(int,   SNIPER_DAMAGE,               120)
+TUNABLE(float, SNIPER_BULLET_LIFETIME,      1.5f)
+TUNABLE(float, SNIPER_PROJECTILE_SIZE,      4.0f)
+TUNABLE(float, SNIPER_SLOW_FACTOR,          0.4f)
+TUNABLE(float, SNIPER_SLOW_DURATION,        2.0f)
+// Sniper — M1 hip fire
+TUNABLE(int,   SNIPER_HIP_SPREAD,           160)     // wide spread (80/1000 rad)
+TUNABLE(float, SNIPER_HIP_COOLDOWN,         0.915f)  // fast semi-auto
+TUNABLE(float, SNIPER_HIP_BULLET_SPEED,     2000.0f) // slightly slower than aimed
+// Sniper — M2 aimed shot (hold M2 + click M1)
+TUNABLE(int,   SNIPER_AIM_SPREAD,           0)       // zero
+TUNABLE(float, SNIPER_AIM_COOLDOWN,         0.915f)  // same as hip
+TUNABLE(float, SNIPER_AIM_BULLET_SPEED,     2800.0f) // faster travel
+TUNABLE(float, SNIPER_AIM_SLOW,             0.35f)   // movement multiplier while ADS
+// Sniper — super shot (dash timing + M2)
+TUNABLE(int,   SNIPER_SUPER_DAMAGE,         300)     // massive payoff
+TUNABLE(float, SNIPER_SUPER_SLOW_DUR,       4.0f)    // longer debuff on target
+TUNABLE(float, SNIPER_SUPER_SLOW_FACTOR,    0.2f)    // stronger slow (vs normal 0.4)
+
+// Enemies ------------------------------------------------------------------ /
+// Spawning
+TUNABLE(float, SPAWN_MARGIN,                400.0f)
+// Boss
+TUNABLE(int,   BOSS_KILL_THRESHOLD,         100)
+// Enemy — Rectangle (ranged)
+TUNABLE(float, RECT_SHOOT_INTERVAL,         0.9f)
+TUNABLE(float, RECT_BULLET_SPEED,           300.0f)
+TUNABLE(int,   RECT_BULLET_DAMAGE,          12)
+TUNABLE(float, RECT_PROJECTILE_SIZE,        4.0f)
+TUNABLE(float, RECT_BULLET_LIFETIME,        10.0f)
+// Enemy — Pentagon (elite ranged)
+TUNABLE(float, PENTA_SHOOT_INTERVAL,        2.5f)
+// Enemy — Hexagon (strafing shooter, fan pattern)
+TUNABLE(float, HEXA_SHOOT_INTERVAL,         2.0f)
+// Attack timing
+TUNABLE(float, TRAP_ATTACK_INTERVAL,        2.5f)
+// Charge + slam
+TUNABLE(float, TRAP_CHARGE_SPEED,           600.0f)
+TUNABLE(float, TRAP_CHARGE_DURATION,        0.6f)
+TUNABLE(float, TRAP_SLAM_RADIUS,            120.0f)
+TUNABLE(int,   TRAP_SLAM_DAMAGE,            25)
+// Attack timing
+TUNABLE(float, CIRC_ATTACK_INTERVAL,        2.0f)
+// Dash (charge)
+TUNABLE(int,   CIRC_SLAM_DAMAGE,            20)
+// Sword sweep
+TUNABLE(float, CIRC_SWORD_DASH_DURATION,    0.12f)
+TUNABLE(float, CIRC_SWORD_DURATION,         0.25f)
+TUNABLE(float, CIRC_SWORD_RADIUS,           130.0f)
+TUNABLE(int,   CIRC_SWORD_DAMAGE,           30)
+// Gun burst
+TUNABLE(float, CIRC_GUN_BURST_DURATION,     1.0f)
+TUNABLE(float, CIRC_GUN_FIRE_RATE,          0.06f)
+TUNABLE(int,   CIRC_GUN_SPREAD,             80)
+TUNABLE(float, CIRC_GUN_SPEED,              800.0f)
+TUNABLE(int,   CIRC_GUN_DAMAGE,             8)
+TUNABLE(float, CIRC_GUN_LIFETIME,           3.0f)
+TUNABLE(float, CIRC_GUN_SIZE,               3.0f)
+// Revolver fan
+TUNABLE(int,   CIRC_REV_COUNT,              6)
+TUNABLE(int,   CIRC_REV_SPREAD,             120)
+TUNABLE(float, CIRC_REV_FAN_COOLDOWN,       0.10f)
+TUNABLE(float, CIRC_REV_SPEED,              1200.0f)
+TUNABLE(int,   CIRC_REV_DAMAGE,             15)
+TUNABLE(float, CIRC_REV_LIFETIME,           2.0f)
+TUNABLE(float, CIRC_REV_SIZE,               4.0f)
+// Sniper shot
+TUNABLE(float, CIRC_SNIPER_SPEED,           2400.0f)
+TUNABLE(int,   CIRC_SNIPER_DAMAGE,          40)
+TUNABLE(float, CIRC_SNIPER_LIFETIME,        1.5f)
+TUNABLE(float, CIRC_SNIPER_SIZE,            4.0f)
+// Rocket
+TUNABLE(float, CIRC_ROCKET_SPEED,           600.0f)
+TUNABLE(int,   CIRC_ROCKET_DAMAGE,          30)
+TUNABLE(float, CIRC_ROCKET_LIFETIME,        3.0f)
+TUNABLE(float, CIRC_ROCKET_SIZE,            6.0f)
@@ -1,58 +1,22 @@
 // update.c
 // mutate the game state with various data transformations
-// handle input
+// Step is the sim, UpdateGame the host around it (input.c samples input)
 #include "game.h"
 
-// M1/M2 wrappers — mouse buttons OR keyboard OR gamepad triggers
-static inline bool M1Down(void) {
-    return IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsKeyDown(KB_M1_KEY)
-        || IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_2);
-}
-static inline bool M1Pressed(void) {
-    return IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsKeyPressed(KB_M1_KEY)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_2);
-}
-static inline bool M2Down(void) {
-    return IsMouseButtonDown(MOUSE_BUTTON_RIGHT) || IsKeyDown(KB_M2_KEY)
-        || IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_2);
-}
-static inline bool M2Pressed(void) {
-    return IsMouseButtonPressed(MOUSE_BUTTON_RIGHT) || IsKeyPressed(KB_M2_KEY)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_2);
-}
+// the frame Step is running on, everything below reads input through it
+static const InputFrame *input;
+
+// M1/M2 — mouse buttons, keyboard and triggers folded together by ReadInput
+static inline bool M1Down(void)    { return input->down & BTN_M1; }
+static inline bool M1Pressed(void) { return input->pressed & BTN_M1; }
+static inline bool M2Down(void)    { return input->down & BTN_M2; }
+static inline bool M2Pressed(void) { return input->pressed & BTN_M2; }
 
 // Dash input — shared by gameplay dash, QTE timing, select screen
-static inline bool DashPressed(void) {
-    return IsKeyPressed(KEY_SPACE)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
-}
+static inline bool DashPressed(void) { return input->pressed & BTN_DASH; }
 
-// Input mode detection — sets g.gamepadActive for HUD display
-static void DetectInputMode(void) {
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        for (int b = 1; b <= GAMEPAD_BUTTON_RIGHT_THUMB; b++) {
-            if (IsGamepadButtonPressed(GAMEPAD_INDEX, b)) {
-                g.gamepadActive = true;
-                return;
-            }
-        }
-        float lx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_X);
-        float ly = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_Y);
-        float rx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_X);
-        float ry = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_Y);
-        if (fabsf(lx) > GAMEPAD_STICK_DEADZONE || fabsf(ly) > GAMEPAD_STICK_DEADZONE ||
-            fabsf(rx) > GAMEPAD_STICK_DEADZONE || fabsf(ry) > GAMEPAD_STICK_DEADZONE) {
-            g.gamepadActive = true;
-            return;
-        }
-    }
-    Vector2 md = GetMouseDelta();
-    if (md.x != 0 || md.y != 0) { g.gamepadActive = false; return; }
-    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
-        g.gamepadActive = false; return;
-    }
-    if (GetKeyPressed() != 0) { g.gamepadActive = false; }
-}
+// Enter or pad A — select, shop, restart
+static inline bool ConfirmPressed(void) { return input->pressed & BTN_CONFIRM; }
 
 // forward declarations for functions used before defined
 static void RocketExplode(Vector2 pos);
@@ -78,7 +42,7 @@ static Vector2 FireHitscan(Vector2 origin, Vector2 dir,
         // Laser: find closest hit, terminate beam there
         int   firstIdx  = -1;
         float firstDist = 1e30f;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             Enemy *e = &g.enemies[i];
             if (!e->active) continue;
             if (EnemyHitSweep(e, origin, rayEnd, 0)) {
@@ -107,10 +71,10 @@ static Vector2 FireHitscan(Vector2 origin, Vector2 dir,
         return rayEnd;
     } else {
         // Railgun: pierce every enemy along ray
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             Enemy *e = &g.enemies[i];
             if (!e->active) continue;
-            if (EnemyHitSweep(e, origin, rayEnd, RAILGUN_BEAM_RADIUS)) {
+            if (EnemyHitSweep(e, origin, rayEnd, TUNE(RAILGUN_BEAM_RADIUS))) {
                 if (damage > 0) {
                     Vector2 hitPos = e->pos;
                     DamageEnemy(i, damage, dmgType, HIT_SCAN);
@@ -122,40 +86,13 @@ static Vector2 FireHitscan(Vector2 origin, Vector2 dir,
     }
 }
 
-static bool IsAbilityPressed(Player *p, AbilityID ability) {
-    for (int i = 0; i < ABILITY_SLOTS; i++) {
-        if (p->slots[i].ability == ability && p->slots[i].owned
-            && IsKeyPressed(p->slots[i].key))
-            return true;
-    }
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        bool lbHeld = IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_1);
-        for (int i = 0; i < (int)PAD_ABILITY_COUNT; i++) {
-            if (PAD_ABILITY_MAP[i].ability == ability
-                && PAD_ABILITY_MAP[i].needsLB == lbHeld
-                && IsGamepadButtonPressed(GAMEPAD_INDEX, PAD_ABILITY_MAP[i].button))
-                return true;
-        }
-    }
-    return false;
+// ReadInput already went through the owned slot keys and the pad map
+static bool IsAbilityPressed(AbilityID ability) {
+    return input->abilityPressed & (1u << ability);
 }
 
-static bool IsAbilityDown(Player *p, AbilityID ability) {
-    for (int i = 0; i < ABILITY_SLOTS; i++) {
-        if (p->slots[i].ability == ability && p->slots[i].owned
-            && IsKeyDown(p->slots[i].key))
-            return true;
-    }
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        bool lbHeld = IsGamepadButtonDown(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_TRIGGER_1);
-        for (int i = 0; i < (int)PAD_ABILITY_COUNT; i++) {
-            if (PAD_ABILITY_MAP[i].ability == ability
-                && PAD_ABILITY_MAP[i].needsLB == lbHeld
-                && IsGamepadButtonDown(GAMEPAD_INDEX, PAD_ABILITY_MAP[i].button))
-                return true;
-        }
-    }
-    return false;
+static bool IsAbilityDown(AbilityID ability) {
+    return input->abilityDown & (1u << ability);
 }
 
 static void UpdateRailgun(Player *p, Vector2 toMouse, float dt)
@@ -163,92 +100,41 @@ static void UpdateRailgun(Player *p, Vector2 toMouse, float dt)
     p->railgun.cooldownTimer -= dt;
     if (p->railgun.cooldownTimer < 0) p->railgun.cooldownTimer = 0;
 
-    if (IsAbilityPressed(p, ABL_RAILGUN) && p->railgun.cooldownTimer <= 0) {
-        p->railgun.cooldownTimer = RAILGUN_COOLDOWN;
+    if (IsAbilityPressed(ABL_RAILGUN) && p->railgun.cooldownTimer <= 0) {
+        p->railgun.cooldownTimer = TUNE(RAILGUN_COOLDOWN);
         Vector2 aimDir = Vector2Normalize(toMouse);
         Vector2 muzzle = Vector2Add(p->pos,
             Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
 
         Vector2 tip = FireHitscan(muzzle, aimDir,
-            RAILGUN_RANGE, RAILGUN_DAMAGE, DMG_BALLISTIC, MAX_ENEMIES);
-        SpawnBeam(muzzle, tip, RAILGUN_BEAM_DURATION,
+            TUNE(RAILGUN_RANGE), TUNE(RAILGUN_DAMAGE), DMG_BALLISTIC, MAX_ENEMIES);
+        SpawnBeam(muzzle, tip, TUNE(RAILGUN_BEAM_DURATION),
             RAILGUN_COLOR, RAILGUN_BEAM_WIDTH);
         SpawnParticles(muzzle, WHITE, RAILGUN_MUZZLE_PARTICLES);
     }
 }
 
-//
-static Vector2 lastKbAim = { 1, 0 };
-static bool kbAimActive = false;
-static float aimGrace[4] = { 0 }; // right, left, down, up
-
-static Vector2 UpdateMouseAim() {
+// aim comes in already resolved (mouse, arrows or right stick), the player
+// faces it
+static Vector2 UpdateAim(void) {
     Player *p = &g.player;
-    float dt = GetFrameTime();
-
-    // Right stick aim (gamepad)
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        float rx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_X) * GAMEPAD_AIM_SENS;
-        float ry = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_RIGHT_Y) * GAMEPAD_AIM_SENS;
-        if (fabsf(rx) > GAMEPAD_STICK_DEADZONE || fabsf(ry) > GAMEPAD_STICK_DEADZONE) {
-            lastKbAim = Vector2Normalize((Vector2){ rx, ry });
-            kbAimActive = true;
-        }
-    }
-
-    // Keyboard aim with grace period for diagonals
-    bool held[4] = {
-        IsKeyDown(KEY_RIGHT) || IsKeyDown(AIM_RIGHT_KEY),
-        IsKeyDown(KEY_LEFT)  || IsKeyDown(AIM_LEFT_KEY),
-        IsKeyDown(KEY_DOWN)  || IsKeyDown(AIM_DOWN_KEY),
-        IsKeyDown(KEY_UP)    || IsKeyDown(AIM_UP_KEY),
-    };
-    for (int i = 0; i < 4; i++) {
-        if (held[i]) aimGrace[i] = AIM_KEY_GRACE;
-        else         aimGrace[i] -= dt;
-    }
-    bool anyHeld = held[0] || held[1] || held[2] || held[3];
-    Vector2 arrowDir = { 0, 0 };
-    if (anyHeld) {
-        if (held[0] || aimGrace[0] > 0) arrowDir.x += 1;
-        if (held[1] || aimGrace[1] > 0) arrowDir.x -= 1;
-        if (held[2] || aimGrace[2] > 0) arrowDir.y += 1;
-        if (held[3] || aimGrace[3] > 0) arrowDir.y -= 1;
-    }
-    float arrowLen = Vector2Length(arrowDir);
-    if (arrowLen > 0) {
-        arrowDir = Vector2Scale(arrowDir, 1.0f / arrowLen);
-        lastKbAim = arrowDir;
-        kbAimActive = true;
-    }
-    // Mouse movement disengages keyboard/stick aim
-    Vector2 mouseDelta = GetMouseDelta();
-    if (mouseDelta.x != 0 || mouseDelta.y != 0) kbAimActive = false;
-    if (kbAimActive) {
-        Vector2 toAim = Vector2Scale(lastKbAim, GAMEPAD_AIM_DIST);
-        p->angle = atan2f(toAim.y, toAim.x);
-        return toAim;
-    }
-    Vector2 screenMouse = GetMousePosition();
-    Vector2 worldMouse = GetScreenToWorld2D(screenMouse, g.camera);
-    Vector2 toMouse = Vector2Subtract(worldMouse, p->pos);
-    p->angle = atan2f(toMouse.y, toMouse.x);
-    return toMouse;
+    p->angle = atan2f(input->aim.y, input->aim.x);
+    return input->aim;
 }
 
 static int CountActiveDeployables(DeployableType type) {
     int count = 0;
-    for (int i = 0; i < MAX_DEPLOYABLES; i++)
+    for (int i = 0; i < g.pool[POOL_DEPLOYABLE].count; i++)
         if (g.deployables[i].active && g.deployables[i].type == type) count++;
     return count;
 }
 
 static void SpawnDeployable(DeployableType type, Vector2 pos);
-static void TrySpawnDeployable(Player *p, AbilityID ability, DeployableType type,
+static void TrySpawnDeployable(AbilityID ability, DeployableType type,
     float *cooldown, float cooldownTime, int maxActive, Vector2 pos, float dt)
 {
     if (*cooldown > 0) *cooldown -= dt;
-    if (IsAbilityPressed(p, ability) && *cooldown <= 0) {
+    if (IsAbilityPressed(ability) && *cooldown <= 0) {
         if (CountActiveDeployables(type) < maxActive) {
             SpawnDeployable(type, pos);
             *cooldown = cooldownTime;
@@ -327,38 +213,27 @@ static void UpdateSelect(float dt)
     Player *p = &g.player;
 
     // WASD + left stick movement
-    Vector2 moveDir = { 0, 0 };
-    if (IsKeyDown(KEY_W)) moveDir.y -= 1;
-    if (IsKeyDown(KEY_S)) moveDir.y += 1;
-    if (IsKeyDown(KEY_A)) moveDir.x -= 1;
-    if (IsKeyDown(KEY_D)) moveDir.x += 1;
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        float lx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_X);
-        float ly = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_Y);
-        if (fabsf(lx) > GAMEPAD_STICK_DEADZONE) moveDir.x += lx;
-        if (fabsf(ly) > GAMEPAD_STICK_DEADZONE) moveDir.y += ly;
-    }
+    Vector2 moveDir = input->move;
     float moveLen = Vector2Length(moveDir);
-    if (moveLen > 1.0f) moveDir = Vector2Scale(moveDir, 1.0f / moveLen);
 
     if (!p->dash.active)
         p->pos = Vector2Add(p->pos, Vector2Scale(moveDir, SELECT_PLAYER_SPEED * dt));
 
     // Dash
-    if (p->dash.charges < p->dash.maxCharges) {
+    if (p->dash.charges < TUNE(DASH_MAX_CHARGES)) {
         p->dash.rechargeTimer -= dt;
         if (p->dash.rechargeTimer <= 0) {
             p->dash.charges++;
-            if (p->dash.charges < p->dash.maxCharges)
-                p->dash.rechargeTimer = p->dash.rechargeTime;
+            if (p->dash.charges < TUNE(DASH_MAX_CHARGES))
+                p->dash.rechargeTimer = TUNE(DASH_COOLDOWN);
         }
     }
     if (DashPressed() && !p->dash.active && p->dash.charges > 0) {
         p->dash.active = true;
-        p->dash.timer = p->dash.duration;
-        bool wasFull = (p->dash.charges == p->dash.maxCharges);
+        p->dash.timer = TUNE(DASH_DURATION);
+        bool wasFull = (p->dash.charges == TUNE(DASH_MAX_CHARGES));
         p->dash.charges--;
-        if (wasFull) p->dash.rechargeTimer = p->dash.rechargeTime;
+        if (wasFull) p->dash.rechargeTimer = TUNE(DASH_COOLDOWN);
         if (moveLen > 0) {
             p->dash.dir = moveDir;
         } else {
@@ -369,7 +244,7 @@ static void UpdateSelect(float dt)
     if (p->dash.active) {
         p->dash.timer -= dt;
         p->pos = Vector2Add(p->pos,
-            Vector2Scale(p->dash.dir, p->dash.speed * dt));
+            Vector2Scale(p->dash.dir, TUNE(DASH_SPEED) * dt));
         if (p->dash.timer <= 0) p->dash.active = false;
     }
 
@@ -377,7 +252,7 @@ static void UpdateSelect(float dt)
     ClampToPlayArea(p);
 
     // Aim (mouse / right stick)
-    UpdateMouseAim();
+    UpdateAim();
 
     // Pedestal positions (U curve inside base room)
     float spacing = BASE_W / SELECT_PEDESTAL_SPACING;
@@ -406,9 +281,7 @@ static void UpdateSelect(float dt)
     // Cheat buttons (available during select too)
     bool nearCheat = false;
     {
-        bool m1 = M1Pressed() || IsKeyPressed(KEY_ENTER)
-            || IsGamepadButtonPressed(GAMEPAD_INDEX,
-                    GAMEPAD_BUTTON_RIGHT_FACE_DOWN);
+        bool m1 = M1Pressed() || ConfirmPressed();
         bool nearInf  = IN_CHEAT_BTN(p->pos, CHEAT_INF_X, CHEAT_INF_Y);
         bool nearBuy  = IN_CHEAT_BTN(p->pos, CHEAT_BUYALL_X, CHEAT_BUYALL_Y);
         bool nearInv  = IN_CHEAT_BTN(p->pos, CHEAT_INVINCIBLE_X, CHEAT_INVINCIBLE_Y);
@@ -441,8 +314,7 @@ static void UpdateSelect(float dt)
 
     // M1 or Enter or A selects weapon
     if (g.selectIndex >= 0 && !nearCheat &&
-        (M1Pressed() || IsKeyPressed(KEY_ENTER)
-         || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_FACE_DOWN))) {
+        (M1Pressed() || ConfirmPressed())) {
         if (g.selectPhase == 0) {
             p->primary = SELECT_WEAPONS[g.selectIndex];
             g.selectPhase = 1;
@@ -461,59 +333,59 @@ static void UpdateSelect(float dt)
     g.selectDemoTimer -= dt;
     if (g.selectDemoTimer <= 0 && g.selectIndex >= 0) {
         float intervals[] = {
-            SWORD_DURATION + 0.3f,          // sword: swing + pause
-            REVOLVER_COOLDOWN,              // revolver: actual cooldown
-            1.0f / GUN_FIRE_RATE,           // gun: actual fire rate
-            SNIPER_AIM_COOLDOWN,            // sniper: aimed cooldown
-            ROCKET_COOLDOWN,                // rocket: actual cooldown
+            TUNE(SWORD_DURATION) + 0.3f,          // sword: swing + pause
+            TUNE(REVOLVER_COOLDOWN),              // revolver: actual cooldown
+            1.0f / TUNE(GUN_FIRE_RATE),           // gun: actual fire rate
+            TUNE(SNIPER_AIM_COOLDOWN),            // sniper: aimed cooldown
+            TUNE(ROCKET_COOLDOWN),                // rocket: actual cooldown
         };
         g.selectDemoTimer += intervals[g.selectIndex];
         int i = g.selectIndex;
         Vector2 base = pedestals[i];
-        float demoAngle = (float)GetTime() * 1.5f;
+        float demoAngle = g.time * 1.5f;
         Vector2 aimDir = { cosf(demoAngle), sinf(demoAngle) };
         Vector2 muzzle = Vector2Add(base,
             Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
         switch (i) {
             case 0: { // SWORD — same as M1 sweep
-                g.selectSwordTimer = SWORD_DURATION;
+                g.selectSwordTimer = TUNE(SWORD_DURATION);
                 g.selectSwordAngle = demoAngle;
-                SpawnSwordSparks(base, demoAngle, SWORD_ARC, SWORD_RADIUS);
+                SpawnSwordSparks(base, demoAngle, TUNE(SWORD_ARC), TUNE(SWORD_RADIUS));
             } break;
             case 1: { // REVOLVER — same as M1 precise shot
-                float spread = ((float)GetRandomValue(
-                    -REVOLVER_PRECISE_SPREAD, REVOLVER_PRECISE_SPREAD))
+                float spread = ((float)SimRandom(
+                    -TUNE(REVOLVER_PRECISE_SPREAD), TUNE(REVOLVER_PRECISE_SPREAD)))
                     * 0.001f;
                 float bulletAngle = demoAngle + spread;
                 Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
                 SpawnProjectile(muzzle, bulletDir,
-                    REVOLVER_BULLET_SPEED, REVOLVER_DAMAGE,
-                    REVOLVER_BULLET_LIFETIME, REVOLVER_PROJECTILE_SIZE,
+                    TUNE(REVOLVER_BULLET_SPEED), TUNE(REVOLVER_DAMAGE),
+                    TUNE(REVOLVER_BULLET_LIFETIME), TUNE(REVOLVER_PROJECTILE_SIZE),
                     false, false, PROJ_BULLET, DMG_BALLISTIC);
                 SpawnParticle(muzzle,
                     Vector2Scale(bulletDir, GUN_MUZZLE_SPEED), WHITE,
                     GUN_MUZZLE_SIZE, GUN_MUZZLE_LIFETIME);
             } break;
             case 2: { // GUN — same as M1 machine gun
-                float spread = ((float)GetRandomValue(
-                    -GUN_SPREAD, GUN_SPREAD)) * 0.001f;
+                float spread = ((float)SimRandom(
+                    -TUNE(GUN_SPREAD), TUNE(GUN_SPREAD))) * 0.001f;
                 float bulletAngle = demoAngle + spread;
                 Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
                 SpawnProjectile(muzzle, bulletDir,
-                    GUN_BULLET_SPEED, GUN_BULLET_DAMAGE,
-                    GUN_BULLET_LIFETIME, GUN_PROJECTILE_SIZE,
+                    TUNE(GUN_BULLET_SPEED), TUNE(GUN_BULLET_DAMAGE),
+                    TUNE(GUN_BULLET_LIFETIME), TUNE(GUN_PROJECTILE_SIZE),
                     false, false, PROJ_BULLET, DMG_BALLISTIC);
                 SpawnParticle(muzzle,
                     Vector2Scale(bulletDir, GUN_MUZZLE_SPEED), WHITE,
                     GUN_MUZZLE_SIZE, GUN_MUZZLE_LIFETIME);
             } break;
             case 3: { // SNIPER — same as M1 hip fire
-                float spread = (float)(GetRandomValue(
-                    -SNIPER_HIP_SPREAD, SNIPER_HIP_SPREAD)) / 1000.0f;
+                float spread = (float)(SimRandom(
+                    -TUNE(SNIPER_HIP_SPREAD), TUNE(SNIPER_HIP_SPREAD))) / 1000.0f;
                 Vector2 dir = Vector2Rotate(aimDir, spread);
                 Projectile *sn = SpawnProjectile(muzzle, dir,
-                    SNIPER_HIP_BULLET_SPEED, SNIPER_DAMAGE,
-                    SNIPER_BULLET_LIFETIME, SNIPER_PROJECTILE_SIZE,
+                    TUNE(SNIPER_HIP_BULLET_SPEED), TUNE(SNIPER_DAMAGE),
+                    TUNE(SNIPER_BULLET_LIFETIME), TUNE(SNIPER_PROJECTILE_SIZE),
                     false, false, PROJ_BULLET, DMG_PIERCE);
                 if (sn) sn->appliesSlow = true;
                 SpawnParticles(muzzle, (Color)SNIPER_COLOR,
@@ -524,8 +396,8 @@ static void UpdateSelect(float dt)
             } break;
             case 4: { // ROCKET — same as SpawnRocket
                 Projectile *r = SpawnProjectile(muzzle, aimDir,
-                    ROCKET_SPEED, ROCKET_DIRECT_DAMAGE,
-                    ROCKET_LIFETIME, ROCKET_PROJECTILE_SIZE,
+                    TUNE(ROCKET_SPEED), TUNE(ROCKET_DIRECT_DAMAGE),
+                    TUNE(ROCKET_LIFETIME), TUNE(ROCKET_PROJECTILE_SIZE),
                     false, true, PROJ_ROCKET, DMG_EXPLOSIVE);
                 (void)r;
                 SpawnParticles(muzzle, RED, ROCKET_MUZZLE_PARTICLES);
@@ -547,9 +419,7 @@ static void UpdateSelect(float dt)
 static void UpdateShop(void)
 {
     Player *p = &g.player;
-    bool m1 = M1Pressed() || IsKeyPressed(KEY_ENTER)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX,
-                GAMEPAD_BUTTON_RIGHT_FACE_DOWN);
+    bool m1 = M1Pressed() || ConfirmPressed();
 
     // Cheat buttons
     bool nearCheat = IN_CHEAT_BTN(p->pos, CHEAT_INF_X, CHEAT_INF_Y)
@@ -612,7 +482,7 @@ static int SweepDamage(
         *lastResetAngle += PI;
     }
     int hits = 0;
-    for (int i = 0; i < MAX_ENEMIES && hits < maxHits; i++) {
+    for (int i = 0; i < g.pool[POOL_ENEMY].count && hits < maxHits; i++) {
         Enemy *ei = &g.enemies[i];
         if (!ei->active) continue;
         if (hitBits[i >> 3] & (1 << (i & 7))) continue;
@@ -629,11 +499,11 @@ static int SweepDamage(
 static void UpdateMovement(Player *p, Vector2 moveDir, float moveLen, float dt)
 {
     if (!p->dash.active) {
-        float moveSpeed = p->speed;
+        float moveSpeed = TUNE(PLAYER_SPEED);
         if (p->primary == WPN_GUN && p->minigun.slowTimer > 0)
-            moveSpeed = p->speed * MINIGUN_SLOW_FACTOR;
+            moveSpeed = TUNE(PLAYER_SPEED) * TUNE(MINIGUN_SLOW_FACTOR);
         if (p->primary == WPN_GUN && p->gun.overheatBoostTimer > 0) {
-            moveSpeed *= GUN_OVERHEAT_DASH_BOOST;
+            moveSpeed *= TUNE(GUN_OVERHEAT_DASH_BOOST);
             // Speed trail particles while boosted
             if (moveLen > 0) {
                 Vector2 trail = { -moveDir.x * GUN_OVERHEAT_TRAIL_SPEED,
@@ -644,18 +514,18 @@ static void UpdateMovement(Player *p, Vector2 moveDir, float moveLen, float dt)
             }
         }
         if (p->primary == WPN_SNIPER && p->sniper.aiming)
-            moveSpeed *= SNIPER_AIM_SLOW;
+            moveSpeed *= TUNE(SNIPER_AIM_SLOW);
         if (p->shield.active)
-            moveSpeed *= SHIELD_SLOW_FACTOR;
+            moveSpeed *= TUNE(SHIELD_SLOW_FACTOR);
         if (p->flame.active)
-            moveSpeed *= FLAME_SLOW_FACTOR;
+            moveSpeed *= TUNE(FLAME_SLOW_FACTOR);
         p->pos = Vector2Add(p->pos, Vector2Scale(moveDir, moveSpeed * dt));
     }
 
     // knockback velocity (rocket jump)
     if (Vector2Length(p->vel) > 1.0f) {
         p->pos = Vector2Add(p->pos, Vector2Scale(p->vel, dt));
-        float decay = ROCKET_JUMP_FRICTION * dt;
+        float decay = TUNE(ROCKET_JUMP_FRICTION) * dt;
         if (decay > 1.0f) decay = 1.0f;
         p->vel = Vector2Scale(p->vel, 1.0f - decay);
     } else {
@@ -668,12 +538,12 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
     p->dash.orbAngle += DASH_ORB_SPEED * dt;
 
     // --- Dash (charge system) ---
-    if (p->dash.charges < p->dash.maxCharges) {
+    if (p->dash.charges < TUNE(DASH_MAX_CHARGES)) {
         p->dash.rechargeTimer -= dt;
         if (p->dash.rechargeTimer <= 0) {
             p->dash.charges++;
-            if (p->dash.charges < p->dash.maxCharges)
-                p->dash.rechargeTimer = p->dash.rechargeTime;
+            if (p->dash.charges < TUNE(DASH_MAX_CHARGES))
+                p->dash.rechargeTimer = TUNE(DASH_COOLDOWN);
         }
     }
 
@@ -707,7 +577,7 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
         if (isSuperDash) {
             p->dash.decoyActive = true;
             p->dash.decoyPos = p->pos;
-            p->dash.decoyTimer = DECOY_DURATION;
+            p->dash.decoyTimer = TUNE(DECOY_DURATION);
             SpawnParticles(p->pos, WHITE, DECOY_EXPIRE_PARTICLES);
         }
         p->dash.superWindow = 0;
@@ -716,12 +586,12 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
         // Normal dash mechanics
         if (p->primary == WPN_SNIPER) p->sniper.adsDuringDash = false;
         p->dash.active = true;
-        p->dash.timer = p->dash.duration;
-        bool wasFull = (p->dash.charges == p->dash.maxCharges);
+        p->dash.timer = TUNE(DASH_DURATION);
+        bool wasFull = (p->dash.charges == TUNE(DASH_MAX_CHARGES));
         p->dash.charges--;
         if (wasFull)
-            p->dash.rechargeTimer = p->dash.rechargeTime;
-        p->iFrames = p->dash.duration;
+            p->dash.rechargeTimer = TUNE(DASH_COOLDOWN);
+        p->iFrames = TUNE(DASH_DURATION);
         if (moveLen > 0) {
             p->dash.dir = moveDir;
         } else {
@@ -736,16 +606,16 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
             p->sword.dashSlash = true;
             memset(p->sword.hitBits, 0, sizeof(p->sword.hitBits));
             p->sword.lastResetAngle = p->sword.angle
-                - (p->sword.arc * DASH_SLASH_ARC_MULT) / 2.0f;
+                - (TUNE(SWORD_ARC) * DASH_SLASH_ARC_MULT) / 2.0f;
         }
     }
 
     if (p->dash.active) {
         p->dash.timer -= dt;
         p->pos = Vector2Add(
-            p->pos, Vector2Scale(p->dash.dir, p->dash.speed * dt));
+            p->pos, Vector2Scale(p->dash.dir, TUNE(DASH_SPEED) * dt));
 
-        float trailAngle = (float)GetRandomValue(0, 360) * DEG2RAD;
+        float trailAngle = (float)VfxRandom(0, 360) * DEG2RAD;
         Vector2 trailVel = { cosf(trailAngle) * DASH_TRAIL_SPEED,
                              sinf(trailAngle) * DASH_TRAIL_SPEED };
         SpawnParticle(p->pos, trailVel, SKYBLUE,
@@ -758,7 +628,7 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
         if (p->dash.timer <= 0) {
             p->dash.active = false;
             // Open super dash window
-            p->dash.superWindow = DASH_SUPER_WINDOW;
+            p->dash.superWindow = TUNE(DASH_SUPER_WINDOW);
             p->dash.superMissed = false;
             // Sniper: only if M2 was pressed during the dash
             if (p->primary == WPN_SNIPER && p->sniper.adsDuringDash) {
@@ -772,8 +642,7 @@ static void UpdateDash(Player *p, Vector2 moveDir, float moveLen, float dt)
 static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
 {
     // --- Weapon swap (Ctrl) ---
-    if (IsKeyPressed(WEAPON_SWAP_KEY)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_LEFT_THUMB)) {
+    if (input->pressed & BTN_SWAP) {
         WeaponType tmp = p->primary;
         p->primary = p->secondary;
         p->secondary = tmp;
@@ -790,7 +659,7 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         if (p->revolver.reloadTimer > 0) {
             p->revolver.reloadTimer -= dt;
             if (p->revolver.reloadTimer <= 0) {
-                p->revolver.rounds = REVOLVER_ROUNDS;
+                p->revolver.rounds = TUNE(REVOLVER_ROUNDS);
                 p->revolver.reloadTimer = 0;
                 p->revolver.reloadLocked = false;
             }
@@ -799,13 +668,13 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
     if (p->primary != WPN_GUN) {
         // Passive heat decay while holstered
         if (p->gun.heat > 0) {
-            p->gun.heat -= GUN_HEAT_DECAY * dt;
+            p->gun.heat -= TUNE(GUN_HEAT_DECAY) * dt;
             if (p->gun.heat <= 0) {
                 p->gun.heat = 0;
                 p->gun.overheated = false;
             }
         }
-        p->minigun.spinUp -= dt / MINIGUN_SPIN_DOWN_TIME;
+        p->minigun.spinUp -= dt / TUNE(MINIGUN_SPIN_DOWN_TIME);
         if (p->minigun.spinUp < 0) p->minigun.spinUp = 0;
     }
 
@@ -818,7 +687,7 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         if (p->gun.overheated) {
             // QTE vent: one chance — press R or Dash in the zone
             if (p->gun.ventResult == 0) {
-                p->gun.ventCursor += GUN_VENT_CURSOR_SPEED * dt;
+                p->gun.ventCursor += TUNE(GUN_VENT_CURSOR_SPEED) * dt;
                 if (p->gun.ventCursor >= 1.0f) {
                     p->gun.ventResult = -1; // missed — no press
                 }
@@ -831,7 +700,7 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
                     if (c >= zs && c <= ze) {
                         p->gun.ventResult = 1;  // hit
                         if (dashPressed) {
-                            p->gun.overheatBoostTimer = GUN_OVERHEAT_BOOST_DUR;
+                            p->gun.overheatBoostTimer = TUNE(GUN_OVERHEAT_BOOST_DUR);
                             // Burst of particles on dash-vent
                             for (int i = 0; i < GUN_VENT_BURST_PARTICLES; i++) {
                                 float a = ((float)i / GUN_VENT_BURST_PARTICLES) * PI * 2.0f;
@@ -848,14 +717,14 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
                 }
             }
             // Decay: fast on hit, normal otherwise
-            float decay = GUN_OVERHEAT_DECAY;
+            float decay = TUNE(GUN_OVERHEAT_DECAY);
             if (p->gun.ventResult == 1)
-                decay = GUN_VENT_HIT_DECAY;
+                decay = TUNE(GUN_VENT_HIT_DECAY);
             p->gun.heat -= decay * dt;
             // Vent particles on hit
             if (p->gun.ventResult == 1) {
                 for (int i = 0; i < 2; i++) {
-                    float vAngle = -PI/2.0f + ((float)GetRandomValue(-30, 30) * 0.01f);
+                    float vAngle = -PI/2.0f + ((float)VfxRandom(-30, 30) * 0.01f);
                     Vector2 vVel = { cosf(vAngle) * GUN_VENT_STEAM_SPEED,
                                      sinf(vAngle) * GUN_VENT_STEAM_SPEED };
                     SpawnParticle(p->pos, vVel,
@@ -863,51 +732,54 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
                         GUN_VENT_STEAM_LIFETIME);
                 }
             }
-            if (p->gun.heat <= GUN_OVERHEAT_CLEAR) {
+            if (p->gun.heat <= TUNE(GUN_OVERHEAT_CLEAR)) {
                 p->gun.heat = 0;
                 p->gun.overheated = false;
             }
             // Force minigun spin down while overheated
-            p->minigun.spinUp -= dt / MINIGUN_SPIN_DOWN_TIME;
+            p->minigun.spinUp -= dt / TUNE(MINIGUN_SPIN_DOWN_TIME);
             if (p->minigun.spinUp < 0) p->minigun.spinUp = 0;
         }
 
         // --- M2: Minigun mode — spin-up + high volume fire, slows movement ---
         p->minigun.cooldown -= dt;
         if (!p->gun.overheated && M2Down()) {
-            p->minigun.slowTimer = MINIGUN_SLOW_LINGER;
-            p->minigun.spinUp += dt / MINIGUN_SPIN_UP_TIME;
+            p->minigun.slowTimer = TUNE(MINIGUN_SLOW_LINGER);
+            p->minigun.spinUp += dt / TUNE(MINIGUN_SPIN_UP_TIME);
             if (p->minigun.spinUp > 1.0f) p->minigun.spinUp = 1.0f;
 
-            float rate = MINIGUN_MIN_FIRE_RATE +
-                (MINIGUN_MAX_FIRE_RATE - MINIGUN_MIN_FIRE_RATE) * p->minigun.spinUp;
+            float rate = TUNE(MINIGUN_MIN_FIRE_RATE) +
+                (TUNE(MINIGUN_MAX_FIRE_RATE) - TUNE(MINIGUN_MIN_FIRE_RATE))
+                * p->minigun.spinUp;
 
             if (p->minigun.cooldown <= 0 && p->minigun.spinUp > 0.1f) {
                 p->minigun.cooldown = 1.0f / rate;
-                int spread = MINIGUN_SPREAD_MIN +
-                    (int)((MINIGUN_SPREAD_MAX - MINIGUN_SPREAD_MIN) * p->minigun.spinUp);
-                float s = ((float)GetRandomValue(-spread, spread)) * 0.001f;
+                int spread = TUNE(MINIGUN_SPREAD_MIN) +
+                    (int)((TUNE(MINIGUN_SPREAD_MAX) - TUNE(MINIGUN_SPREAD_MIN))
+                    * p->minigun.spinUp);
+                float s = ((float)SimRandom(-spread, spread)) * 0.001f;
                 float bulletAngle = p->angle + s;
                 Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
                 Vector2 aimDir = Vector2Normalize(toMouse);
                 Vector2 muzzle =
                     Vector2Add(p->pos, Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
                 SpawnProjectile(muzzle, bulletDir,
-                    MINIGUN_BULLET_SPEED, MINIGUN_BULLET_DAMAGE,
-                    MINIGUN_BULLET_LIFETIME, MINIGUN_PROJECTILE_SIZE, false, false,
+                    TUNE(MINIGUN_BULLET_SPEED), TUNE(MINIGUN_BULLET_DAMAGE),
+                    TUNE(MINIGUN_BULLET_LIFETIME), TUNE(MINIGUN_PROJECTILE_SIZE),
+                    false, false,
                     PROJ_BULLET, DMG_BALLISTIC);
                 SpawnParticle(muzzle,
                     Vector2Scale(bulletDir, MINIGUN_MUZZLE_SPEED), WHITE,
                     MINIGUN_MUZZLE_SIZE, MINIGUN_MUZZLE_LIFETIME);
                 // Heat accumulation (M2)
-                p->gun.heat += MINIGUN_HEAT_PER_SHOT;
+                p->gun.heat += TUNE(MINIGUN_HEAT_PER_SHOT);
                 p->gun.heatDecayWait = 0;
                 firing = true;
             }
         } else if (!p->gun.overheated) {
             p->minigun.slowTimer -= dt;
             if (p->minigun.slowTimer < 0) p->minigun.slowTimer = 0;
-            p->minigun.spinUp -= dt / MINIGUN_SPIN_DOWN_TIME;
+            p->minigun.spinUp -= dt / TUNE(MINIGUN_SPIN_DOWN_TIME);
             if (p->minigun.spinUp < 0) p->minigun.spinUp = 0;
 
             // M1: Normal machine gun (only when not spinning minigun)
@@ -915,44 +787,45 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
                 && p->gun.cooldown <= 0
                 && p->sword.timer <= 0
             ) {
-                p->gun.cooldown = 1.0f / p->gun.fireRate;
+                p->gun.cooldown = 1.0f / TUNE(GUN_FIRE_RATE);
                 Vector2 aimDir = Vector2Normalize(toMouse);
-                float spread = ((float)GetRandomValue(-GUN_SPREAD, GUN_SPREAD)) * 0.001f;
+                float spread = ((float)SimRandom(
+                    -TUNE(GUN_SPREAD), TUNE(GUN_SPREAD))) * 0.001f;
                 float bulletAngle = p->angle + spread;
                 Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
                 Vector2 muzzle =
                     Vector2Add(p->pos, Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
                 SpawnProjectile(muzzle, bulletDir,
-                    GUN_BULLET_SPEED, GUN_BULLET_DAMAGE,
-                    GUN_BULLET_LIFETIME, GUN_PROJECTILE_SIZE, false, false,
+                    TUNE(GUN_BULLET_SPEED), TUNE(GUN_BULLET_DAMAGE),
+                    TUNE(GUN_BULLET_LIFETIME), TUNE(GUN_PROJECTILE_SIZE), false, false,
                     PROJ_BULLET, DMG_BALLISTIC);
                 SpawnParticle(muzzle,
                               Vector2Scale(bulletDir, GUN_MUZZLE_SPEED), WHITE,
                               GUN_MUZZLE_SIZE, GUN_MUZZLE_LIFETIME);
                 // Heat accumulation (M1)
-                p->gun.heat += GUN_HEAT_PER_SHOT;
+                p->gun.heat += TUNE(GUN_HEAT_PER_SHOT);
                 p->gun.heatDecayWait = 0;
                 firing = true;
             }
         }
 
         // Check overheat trigger — start QTE
-        if (p->gun.heat >= GUN_OVERHEAT_THRESHOLD) {
+        if (p->gun.heat >= TUNE(GUN_OVERHEAT_THRESHOLD)) {
             p->gun.heat = 1.0f;
             p->gun.overheated = true;
             p->gun.ventCursor = 0;
             p->gun.ventResult = 0;
-            float range = GUN_VENT_ZONE_MAX - GUN_VENT_ZONE_MIN;
-            p->gun.ventZoneStart = GUN_VENT_ZONE_MIN +
-                ((float)GetRandomValue(0, 1000) * 0.001f) * range;
+            float range = TUNE(GUN_VENT_ZONE_MAX) - TUNE(GUN_VENT_ZONE_MIN);
+            p->gun.ventZoneStart = TUNE(GUN_VENT_ZONE_MIN) +
+                ((float)SimRandom(0, 1000) * 0.001f) * range;
             p->gun.ventZoneWidth = GUN_VENT_ZONE_WIDTH;
         }
 
         // Passive heat decay: only after not firing for GUN_HEAT_DECAY_DELAY
         if (!p->gun.overheated && !firing) {
             p->gun.heatDecayWait += dt;
-            if (p->gun.heatDecayWait >= GUN_HEAT_DECAY_DELAY) {
-                p->gun.heat -= GUN_HEAT_DECAY * dt;
+            if (p->gun.heatDecayWait >= TUNE(GUN_HEAT_DECAY_DELAY)) {
+                p->gun.heat -= TUNE(GUN_HEAT_DECAY) * dt;
                 if (p->gun.heat < 0) p->gun.heat = 0;
             }
         }
@@ -993,25 +866,26 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
             int damage;
 
             if (p->sniper.aiming) {
-                damage  = p->sniper.superShotReady ? SNIPER_SUPER_DAMAGE : SNIPER_DAMAGE;
-                spreadVal = SNIPER_AIM_SPREAD;
-                speed   = SNIPER_AIM_BULLET_SPEED;
-                cooldown = SNIPER_AIM_COOLDOWN;
+                damage  = p->sniper.superShotReady
+                    ? TUNE(SNIPER_SUPER_DAMAGE) : TUNE(SNIPER_DAMAGE);
+                spreadVal = TUNE(SNIPER_AIM_SPREAD);
+                speed   = TUNE(SNIPER_AIM_BULLET_SPEED);
+                cooldown = TUNE(SNIPER_AIM_COOLDOWN);
             } else {
-                damage  = SNIPER_DAMAGE;
-                spreadVal = SNIPER_HIP_SPREAD;
-                speed   = SNIPER_HIP_BULLET_SPEED;
-                cooldown = SNIPER_HIP_COOLDOWN;
+                damage  = TUNE(SNIPER_DAMAGE);
+                spreadVal = TUNE(SNIPER_HIP_SPREAD);
+                speed   = TUNE(SNIPER_HIP_BULLET_SPEED);
+                cooldown = TUNE(SNIPER_HIP_COOLDOWN);
             }
 
-            float spread = (float)(GetRandomValue(-spreadVal, spreadVal)) / 1000.0f;
+            float spread = (float)(SimRandom(-spreadVal, spreadVal)) / 1000.0f;
             Vector2 dir = Vector2Rotate(aimDir, spread);
             Vector2 muzzle = Vector2Add(p->pos,
                 Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
 
             Projectile *sn = SpawnProjectile(muzzle, dir,
                 speed, damage,
-                SNIPER_BULLET_LIFETIME, SNIPER_PROJECTILE_SIZE, false, false,
+                TUNE(SNIPER_BULLET_LIFETIME), TUNE(SNIPER_PROJECTILE_SIZE), false, false,
                 PROJ_BULLET, DMG_PIERCE);
             if (sn) sn->appliesSlow = true;
             p->sniper.cooldownTimer = cooldown;
@@ -1041,21 +915,21 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
             && p->sword.timer <= 0
             && p->spin.timer <= 0
         ) {
-            p->sword.timer = p->sword.duration;
+            p->sword.timer = TUNE(SWORD_DURATION);
             p->sword.angle = p->angle;
             p->sword.lunge = false;
             p->sword.dashSlash = p->dash.active;
             memset(p->sword.hitBits, 0, sizeof(p->sword.hitBits));
-            p->sword.lastResetAngle = p->sword.angle - p->sword.arc / 2.0f;
+            p->sword.lastResetAngle = p->sword.angle - TUNE(SWORD_ARC) / 2.0f;
 
-            SpawnSwordSparks(p->pos, p->sword.angle, p->sword.arc, p->sword.radius);
+            SpawnSwordSparks(p->pos, p->sword.angle, TUNE(SWORD_ARC), TUNE(SWORD_RADIUS));
         }
         // M2: Lunge
         if (M2Pressed()
             && p->sword.timer <= 0
             && p->spin.timer <= 0
         ) {
-            p->sword.timer = LUNGE_DURATION;
+            p->sword.timer = TUNE(LUNGE_DURATION);
             p->sword.angle = p->angle;
             p->sword.lunge = true;
             p->sword.dashSlash = p->dash.active;
@@ -1063,7 +937,7 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
 
             // Spark burst along thrust line
             float range = p->dash.active ?
-                LUNGE_RANGE * LUNGE_DASH_RANGE_MULT : LUNGE_RANGE;
+                TUNE(LUNGE_RANGE) * LUNGE_DASH_RANGE_MULT : TUNE(LUNGE_RANGE);
             for (int i = 0; i < SWORD_SPARK_COUNT; i++) {
                 float t = (float)(i + 1) / SWORD_SPARK_COUNT;
                 Vector2 particlePos = Vector2Add(p->pos,
@@ -1079,25 +953,25 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
     case WPN_REVOLVER:
         // Reload
         if (p->revolver.reloadTimer > 0) {
-            float progress = 1.0f - (p->revolver.reloadTimer / REVOLVER_RELOAD_TIME);
+            float progress = 1.0f - (p->revolver.reloadTimer / TUNE(REVOLVER_RELOAD_TIME));
             // Active reload: M1 or Space during reload
             bool reloadInput = M1Pressed() || DashPressed();
             if (reloadInput && !p->revolver.reloadLocked) {
-                bool inSweet = progress >= REVOLVER_RELOAD_SWEET_START
-                    && progress <= REVOLVER_RELOAD_SWEET_END;
+                bool inSweet = progress >= TUNE(REVOLVER_RELOAD_SWEET_START)
+                    && progress <= TUNE(REVOLVER_RELOAD_SWEET_END);
                 if (inSweet) {
-                    p->revolver.reloadTimer = REVOLVER_RELOAD_FAST_TIME;
+                    p->revolver.reloadTimer = TUNE(REVOLVER_RELOAD_FAST_TIME);
                     // Dash reload — next cylinder does double damage
                     if (DashPressed())
-                        p->revolver.bonusRounds = REVOLVER_ROUNDS;
+                        p->revolver.bonusRounds = TUNE(REVOLVER_ROUNDS);
                 } else {
-                    p->revolver.reloadTimer += REVOLVER_RELOAD_FAIL_PENALTY;
+                    p->revolver.reloadTimer += TUNE(REVOLVER_RELOAD_FAIL_PENALTY);
                 }
                 p->revolver.reloadLocked = true;
             }
             p->revolver.reloadTimer -= dt;
             if (p->revolver.reloadTimer <= 0) {
-                p->revolver.rounds = REVOLVER_ROUNDS;
+                p->revolver.rounds = TUNE(REVOLVER_ROUNDS);
                 p->revolver.reloadTimer = 0;
                 p->revolver.reloadLocked = false;
             }
@@ -1107,19 +981,21 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         if (p->revolver.fanning) {
             p->revolver.cooldownTimer -= dt;
             if (p->revolver.cooldownTimer <= 0 && p->revolver.rounds > 0) {
-                p->revolver.cooldownTimer = REVOLVER_FAN_COOLDOWN;
-                int dmg = REVOLVER_DAMAGE;
+                p->revolver.cooldownTimer = TUNE(REVOLVER_FAN_COOLDOWN);
+                int dmg = TUNE(REVOLVER_DAMAGE);
                 bool bonus = p->revolver.bonusRounds > 0;
                 if (bonus) { dmg *= 2; p->revolver.bonusRounds--; }
                 Vector2 aimDir = Vector2Normalize(toMouse);
-                float spread = ((float)GetRandomValue(-REVOLVER_FAN_SPREAD, REVOLVER_FAN_SPREAD)) * 0.001f;
+                float spread = ((float)SimRandom(-TUNE(REVOLVER_FAN_SPREAD),
+                    TUNE(REVOLVER_FAN_SPREAD))) * 0.001f;
                 float bulletAngle = p->angle + spread;
                 Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
                 Vector2 muzzle = Vector2Add(p->pos,
                     Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
                 SpawnProjectile(muzzle, bulletDir,
-                    REVOLVER_BULLET_SPEED, dmg,
-                    REVOLVER_BULLET_LIFETIME, REVOLVER_PROJECTILE_SIZE, false, false,
+                    TUNE(REVOLVER_BULLET_SPEED), dmg,
+                    TUNE(REVOLVER_BULLET_LIFETIME), TUNE(REVOLVER_PROJECTILE_SIZE),
+                    false, false,
                     PROJ_BULLET, DMG_BALLISTIC);
                 SpawnParticle(muzzle,
                     Vector2Scale(bulletDir, GUN_MUZZLE_SPEED),
@@ -1134,18 +1010,20 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         if (M1Pressed()
             && p->revolver.rounds > 0
         ) {
-            int dmg = REVOLVER_DAMAGE;
+            int dmg = TUNE(REVOLVER_DAMAGE);
             bool bonus = p->revolver.bonusRounds > 0;
             if (bonus) { dmg *= 2; p->revolver.bonusRounds--; }
             Vector2 aimDir = Vector2Normalize(toMouse);
-            float spread = ((float)GetRandomValue(-REVOLVER_PRECISE_SPREAD, REVOLVER_PRECISE_SPREAD)) * 0.001f;
+            float spread = ((float)SimRandom(-TUNE(REVOLVER_PRECISE_SPREAD),
+                TUNE(REVOLVER_PRECISE_SPREAD))) * 0.001f;
             float bulletAngle = p->angle + spread;
             Vector2 bulletDir = { cosf(bulletAngle), sinf(bulletAngle) };
             Vector2 muzzle = Vector2Add(p->pos,
                 Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
             SpawnProjectile(muzzle, bulletDir,
-                REVOLVER_BULLET_SPEED, dmg,
-                REVOLVER_BULLET_LIFETIME, REVOLVER_PROJECTILE_SIZE, false, false,
+                TUNE(REVOLVER_BULLET_SPEED), dmg,
+                TUNE(REVOLVER_BULLET_LIFETIME), TUNE(REVOLVER_PROJECTILE_SIZE),
+                false, false,
                 PROJ_BULLET, DMG_BALLISTIC);
             SpawnParticle(muzzle,
                 Vector2Scale(bulletDir, GUN_MUZZLE_SPEED),
@@ -1163,7 +1041,7 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         // Auto-reload when empty
         if (p->revolver.reloadTimer <= 0
             && p->revolver.rounds <= 0) {
-            p->revolver.reloadTimer = REVOLVER_RELOAD_TIME;
+            p->revolver.reloadTimer = TUNE(REVOLVER_RELOAD_TIME);
             p->revolver.reloadLocked = false;
         }
         break;
@@ -1171,14 +1049,13 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         // M1: Rocket
         if (M1Pressed() && p->rocket.cooldownTimer <= 0) {
             SpawnRocket(p, toMouse);
-            p->rocket.cooldownTimer = ROCKET_COOLDOWN;
+            p->rocket.cooldownTimer = TUNE(ROCKET_COOLDOWN);
         }
         // M2: Detonate oldest in-flight rocket
         if (M2Pressed()) {
-            for (int i = 0; i < MAX_PROJECTILES; i++) {
-                Projectile *b = &g.projectiles[i];
-                if (b->active && b->type == PROJ_ROCKET
-                    && !b->isEnemy) {
+            for (int i = 0; i < g.pool[POOL_PLAYER_SHOT].count; i++) {
+                Projectile *b = &g.playerShots[i];
+                if (b->active && b->type == PROJ_ROCKET) {
                     RocketExplode(b->pos);
                     b->active = false;
                     break;
@@ -1194,19 +1071,19 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
         // Sweep: line hits enemies as it passes over them
         float radius =
             p->sword.dashSlash ?
-            p->sword.radius * DASH_SLASH_RADIUS_MULT :
-            p->sword.radius;
+            TUNE(SWORD_RADIUS) * DASH_SLASH_RADIUS_MULT :
+            TUNE(SWORD_RADIUS);
         float arc = p->sword.dashSlash ?
-            p->sword.arc * DASH_SLASH_ARC_MULT : p->sword.arc;
-        int dmg = p->sword.dashSlash ? SWORD_DASH_DAMAGE : SWORD_DAMAGE;
-        float progress = 1.0f - (p->sword.timer / p->sword.duration);
+            TUNE(SWORD_ARC) * DASH_SLASH_ARC_MULT : TUNE(SWORD_ARC);
+        int dmg = p->sword.dashSlash ? TUNE(SWORD_DASH_DAMAGE) : TUNE(SWORD_DAMAGE);
+        float progress = 1.0f - (p->sword.timer / TUNE(SWORD_DURATION));
         float sweepAngle =
             p->sword.angle - arc / 2.0f + arc * progress;
         Vector2 sweepEnd = Vector2Add(p->pos,
             (Vector2){ cosf(sweepAngle) * radius,
                        sinf(sweepAngle) * radius });
 
-        int hits[MAX_ENEMIES];
+        static int hits[MAX_ENEMIES];  // too big for the web stack
         SweepDamage(p->pos, sweepEnd, sweepAngle,
             dmg, DMG_SLASH, p->sword.hitBits, &p->sword.lastResetAngle,
             hits, MAX_ENEMIES);
@@ -1215,27 +1092,22 @@ static void UpdateWeapon(Player *p, Vector2 toMouse, float dt)
     if (p->sword.timer > 0 && p->sword.lunge) {
         // Lunge: forward thrust, pierce all enemies in cone
         float range = p->sword.dashSlash ?
-            LUNGE_RANGE * LUNGE_DASH_RANGE_MULT : LUNGE_RANGE;
+            TUNE(LUNGE_RANGE) * LUNGE_DASH_RANGE_MULT : TUNE(LUNGE_RANGE);
         float lungeSpeed = p->sword.dashSlash ?
-            LUNGE_SPEED * LUNGE_DASH_SPEED_MULT : LUNGE_SPEED;
-        int dmg = p->sword.dashSlash ? LUNGE_DASH_DAMAGE : LUNGE_DAMAGE;
+            TUNE(LUNGE_SPEED) * LUNGE_DASH_SPEED_MULT : TUNE(LUNGE_SPEED);
+        int dmg = p->sword.dashSlash ? TUNE(LUNGE_DASH_DAMAGE) : TUNE(LUNGE_DAMAGE);
 
         // Move player forward along committed direction
         Vector2 dir = { cosf(p->sword.angle), sinf(p->sword.angle) };
         p->pos = Vector2Add(p->pos, Vector2Scale(dir, lungeSpeed * dt));
 
         // Cone damage — pierce all enemies in range
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        ArcSector cone = MakeArc(p->pos, p->sword.angle, TUNE(LUNGE_CONE_HALF), range);
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             Enemy *ei = &g.enemies[i];
             if (!ei->active) continue;
             if (p->sword.hitBits[i >> 3] & (1 << (i & 7))) continue; // already hit
-
-            Vector2 toEnemy = Vector2Subtract(ei->pos, p->pos);
-            float dist = Vector2Length(toEnemy);
-            if (dist > range + ei->size) continue;
-            float enemyAngle = atan2f(toEnemy.y, toEnemy.x);
-            float angleDiff = fabsf(fmodf(enemyAngle - p->sword.angle + PI, 2*PI) - PI);
-            if (angleDiff > LUNGE_CONE_HALF) continue;
+            if (!InArc(&cone, ei->pos, ei->size)) continue;
 
             DamageEnemy(i, dmg, DMG_PIERCE, HIT_MELEE);
             p->sword.hitBits[i >> 3] |= (1 << (i & 7)); // mark as hit
@@ -1253,23 +1125,23 @@ static void UpdateBlinkDagger(Player *p, Vector2 toMouse, float dt)
         p->blink.damageTimer -= dt;
         if (p->blink.damageTimer <= 0) {
             p->blink.damageActive = false;
-            for (int i = 0; i < MAX_ENEMIES; i++) {
+            for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
                 Enemy *e = &g.enemies[i];
                 if (!e->active || !e->blinkMarked) continue;
-                DamageEnemy(i, BLINK_DAMAGE,
+                DamageEnemy(i, TUNE(BLINK_DAMAGE),
                     DMG_SLASH, HIT_MELEE);
                 e->blinkMarked = false;
             }
         }
     }
 
-    if (!IsAbilityPressed(p, ABL_BLINK)) return;
+    if (!IsAbilityPressed(ABL_BLINK)) return;
     if (p->blink.cooldown > 0) return;
 
     Vector2 dir = Vector2Normalize(toMouse);
     Vector2 origin = p->pos;
     Vector2 dest = Vector2Add(origin,
-        Vector2Scale(dir, BLINK_DISTANCE));
+        Vector2Scale(dir, TUNE(BLINK_DISTANCE)));
 
     // Clamp to map bounds
     dest = Vector2Clamp(dest,
@@ -1280,18 +1152,18 @@ static void UpdateBlinkDagger(Player *p, Vector2 toMouse, float dt)
     p->pos = dest;
 
     // Always 10s — damage cuts it to 3s via DamagePlayer
-    p->blink.cooldown = BLINK_COOLDOWN;
+    p->blink.cooldown = TUNE(BLINK_COOLDOWN);
 
     // Queue delayed damage + mark enemies in the path
     p->blink.damageActive = true;
-    p->blink.damageTimer  = BLINK_DAMAGE_DELAY;
+    p->blink.damageTimer  = TUNE(BLINK_DAMAGE_DELAY);
     p->blink.slashOrigin  = origin;
     p->blink.slashTip     = dest;
-    for (int i = 0; i < MAX_ENEMIES; i++) {
+    for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
         Enemy *e = &g.enemies[i];
         if (!e->active) continue;
         if (EnemyHitSweep(e, origin, dest, BLINK_BEAM_WIDTH)) {
-            e->blinkMark = BLINK_DAMAGE_DELAY;
+            e->blinkMark = TUNE(BLINK_DAMAGE_DELAY);
             e->blinkMarked = true;
         }
     }
@@ -1317,12 +1189,12 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
     p->spin.cooldownTimer -= dt;
     if (p->spin.cooldownTimer < 0) p->spin.cooldownTimer = 0;
 
-    if (IsAbilityPressed(p, ABL_SPIN)
+    if (IsAbilityPressed(ABL_SPIN)
         && p->spin.timer <= 0
         && p->spin.cooldownTimer <= 0
     ) {
-        p->spin.timer = p->spin.duration;
-        p->spin.cooldownTimer = p->spin.cooldown;
+        p->spin.timer = TUNE(SPIN_DURATION);
+        p->spin.cooldownTimer = TUNE(SPIN_COOLDOWN);
         memset(p->spin.hitBits, 0, sizeof(p->spin.hitBits));
         p->spin.lastResetAngle = 0.0f;
 
@@ -1332,8 +1204,8 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
             Vector2 particlePos = Vector2Add(
                 p->pos,
                 (Vector2){
-                    cosf(a) * p->spin.radius * SPIN_BURST_INNER_FRAC,
-                    sinf(a) * p->spin.radius * SPIN_BURST_INNER_FRAC
+                    cosf(a) * TUNE(SPIN_RADIUS) * SPIN_BURST_INNER_FRAC,
+                    sinf(a) * TUNE(SPIN_RADIUS) * SPIN_BURST_INNER_FRAC
                 });
             Vector2 particleVel = { cosf(a) * SPIN_BURST_SPEED,
                                     sinf(a) * SPIN_BURST_SPEED };
@@ -1344,35 +1216,41 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
 
     // Spin damage — sweep line hits enemies as it passes over them
     if (p->spin.timer > 0) {
-        float progress = 1.0f - (p->spin.timer / p->spin.duration);
+        float progress = 1.0f - (p->spin.timer / TUNE(SPIN_DURATION));
         float sweepAngle = PI * 4.0f * progress;
         Vector2 sweepEnd = Vector2Add(p->pos,
-            (Vector2){ cosf(sweepAngle) * p->spin.radius,
-                       sinf(sweepAngle) * p->spin.radius });
+            (Vector2){ cosf(sweepAngle) * TUNE(SPIN_RADIUS),
+                       sinf(sweepAngle) * TUNE(SPIN_RADIUS) });
 
-        int hits[MAX_ENEMIES];
+        static int hits[MAX_ENEMIES];  // too big for the web stack
         int nhits = SweepDamage(p->pos, sweepEnd, sweepAngle,
-            SPIN_DAMAGE, DMG_SLASH, p->spin.hitBits, &p->spin.lastResetAngle,
+            TUNE(SPIN_DAMAGE), DMG_SLASH, p->spin.hitBits, &p->spin.lastResetAngle,
             hits, MAX_ENEMIES);
         for (int h = 0; h < nhits; h++) {
             Enemy *ei = &g.enemies[hits[h]];
-            float heal = SPIN_DAMAGE * SPIN_LIFESTEAL;
+            float heal = TUNE(SPIN_DAMAGE) * TUNE(SPIN_LIFESTEAL);
             p->hp = p->hp + heal;
-            if (p->hp > p->maxHp) p->hp = p->maxHp;
+            if (p->hp > TUNE(PLAYER_HP)) p->hp = TUNE(PLAYER_HP);
             SpawnParticles(ei->pos, GREEN,
                 (int)(heal * SPIN_HEAL_PARTICLE_MULT));
             Vector2 kb = Vector2Normalize(
                 Vector2Subtract(ei->pos, p->pos));
-            ei->vel = Vector2Scale(kb, SPIN_KNOCKBACK);
-        }
-
-        // deflect enemy bullets inside spin radius
-        for (int i = 0; i < MAX_PROJECTILES; i++) {
-            Projectile *b = &g.projectiles[i];
-            if (!b->active || !b->isEnemy) continue;
-            float dist = Vector2Distance(b->pos, p->pos);
-            if (dist < p->spin.radius) {
-                b->isEnemy = false;
+            ei->vel = Vector2Scale(kb, TUNE(SPIN_KNOCKBACK));
+        }
+
+        // deflect enemy bullets inside spin radius, they change sides so
+        // they move over to the player pool
+        for (int i = 0; i < g.pool[POOL_ENEMY_SHOT].count; i++) {
+            Projectile *eb = &g.enemyShots[i];
+            if (!eb->active) continue;
+            float dist = Vector2Distance(eb->pos, p->pos);
+            if (dist < TUNE(SPIN_RADIUS)) {
+                eb->active = false;
+                int s = ClaimSlot(POOL_PLAYER_SHOT);
+                if (s < 0) continue;
+                Projectile *b = &g.playerShots[s];
+                *b = *eb;
+                b->active = true;
                 b->damage *= SPIN_DEFLECT_DAMAGE_MULT;
                 Vector2 away = Vector2Normalize(
                     Vector2Subtract(b->pos, p->pos));
@@ -1390,15 +1268,15 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
         p->shotgun.cooldownTimer -= dt;
         if (p->shotgun.cooldownTimer <= 0) {
             p->shotgun.cooldownTimer = 0;
-            p->shotgun.blastsLeft = SHOTGUN_BLASTS;
+            p->shotgun.blastsLeft = TUNE(SHOTGUN_BLASTS);
         }
     }
 
-    if (IsAbilityPressed(p, ABL_SHOTGUN) && p->shotgun.blastsLeft > 0) {
+    if (IsAbilityPressed(ABL_SHOTGUN) && p->shotgun.blastsLeft > 0) {
         FireShotgunBlast(p, toMouse);
         p->shotgun.blastsLeft--;
         if (p->shotgun.blastsLeft == 0)
-            p->shotgun.cooldownTimer = SHOTGUN_COOLDOWN;
+            p->shotgun.cooldownTimer = TUNE(SHOTGUN_COOLDOWN);
     }
 
     // rocket launcher cooldown (fired via M1 when WPN_ROCKET primary)
@@ -1409,21 +1287,22 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
     if (p->grenade.cooldownTimer > 0)
         p->grenade.cooldownTimer -= dt;
 
-    if (IsAbilityPressed(p, ABL_GRENADE) && p->grenade.cooldownTimer <= 0) {
+    if (IsAbilityPressed(ABL_GRENADE) && p->grenade.cooldownTimer <= 0) {
         SpawnGrenade(p, toMouse);
-        p->grenade.cooldownTimer = GRENADE_COOLDOWN;
+        p->grenade.cooldownTimer = TUNE(GRENADE_COOLDOWN);
     }
 
     UpdateRailgun(p, toMouse, dt);
 
     // bfg10k — charges from damage dealt, fires when full
-    if (IsAbilityPressed(p, ABL_BFG) && p->bfg.charge >= BFG_CHARGE_COST && !p->bfg.active) {
+    if (IsAbilityPressed(ABL_BFG) && p->bfg.charge >= TUNE(BFG_CHARGE_COST)
+        && !p->bfg.active) {
         Vector2 aimDir = Vector2Normalize(toMouse);
         Vector2 muzzle = Vector2Add(p->pos,
             Vector2Scale(aimDir, p->size + MUZZLE_OFFSET));
         SpawnProjectile(muzzle, aimDir,
-            BFG_SPEED, BFG_DIRECT_DAMAGE,
-            BFG_LIFETIME, BFG_PROJECTILE_SIZE, false, false,
+            TUNE(BFG_SPEED), TUNE(BFG_DIRECT_DAMAGE),
+            TUNE(BFG_LIFETIME), TUNE(BFG_PROJECTILE_SIZE), false, false,
             PROJ_BFG, DMG_ABILITY);
         p->bfg.charge = 0;
         p->bfg.active = true;
@@ -1436,7 +1315,7 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
 
     // --- Shield (hold to maintain) ---
     {
-        bool wantShield = IsAbilityDown(p, ABL_SHIELD)
+        bool wantShield = IsAbilityDown(ABL_SHIELD)
             && p->shield.hp > 0
             && p->shield.regenTimer >= 0; // not broken (negative = broken cooldown)
         if (wantShield) {
@@ -1446,7 +1325,7 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
         } else {
             if (p->shield.active) {
                 // just lowered — start regen delay
-                p->shield.regenTimer = SHIELD_REGEN_DELAY;
+                p->shield.regenTimer = TUNE(SHIELD_REGEN_DELAY);
             }
             p->shield.active = false;
             // Regen timer + HP regen
@@ -1455,10 +1334,10 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
                 if (p->shield.regenTimer < 0)
                     p->shield.regenTimer = 0;
             } else if (p->shield.regenTimer >= 0
-                && p->shield.hp < p->shield.maxHp) {
-                p->shield.hp += SHIELD_REGEN_RATE * dt;
-                if (p->shield.hp > p->shield.maxHp)
-                    p->shield.hp = p->shield.maxHp;
+                && p->shield.hp < TUNE(SHIELD_MAX_HP)) {
+                p->shield.hp += TUNE(SHIELD_REGEN_RATE) * dt;
+                if (p->shield.hp > TUNE(SHIELD_MAX_HP))
+                    p->shield.hp = TUNE(SHIELD_MAX_HP);
             }
             // Broken cooldown recovery
             if (p->shield.regenTimer < 0) {
@@ -1475,34 +1354,32 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
     if (p->slam.cooldownTimer > 0) p->slam.cooldownTimer -= dt;
     if (p->slam.vfxTimer > 0) p->slam.vfxTimer -= dt;
 
-    if (IsAbilityPressed(p, ABL_SLAM) && p->slam.cooldownTimer <= 0) {
-        p->slam.cooldownTimer = SLAM_COOLDOWN;
+    if (IsAbilityPressed(ABL_SLAM) && p->slam.cooldownTimer <= 0) {
+        p->slam.cooldownTimer = TUNE(SLAM_COOLDOWN);
         p->slam.vfxTimer = SLAM_VFX_DURATION;
         p->slam.angle = p->angle;
-        float halfArc = SLAM_ARC * 0.5f;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        float halfArc = TUNE(SLAM_ARC) * 0.5f;
+        ArcSector cone = MakeArc(p->pos, p->slam.angle, halfArc, TUNE(SLAM_RANGE));
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             if (!g.enemies[i].active) continue;
             Enemy *ei = &g.enemies[i];
-            float dist = Vector2Distance(p->pos, ei->pos);
-            if (dist > SLAM_RANGE + ei->size) continue;
-            // cone check
+            if (!InArc(&cone, ei->pos, ei->size)) continue;
             Vector2 toEnemy = Vector2Subtract(ei->pos, p->pos);
-            float enemyAngle = atan2f(toEnemy.y, toEnemy.x);
-            float diff = fmodf(enemyAngle - p->slam.angle + 3*PI, 2*PI) - PI;
-            if (fabsf(diff) > halfArc) continue;
+            float dist = Vector2Length(toEnemy);
 
-            DamageEnemy(i, SLAM_DAMAGE, DMG_BLUNT, HIT_AOE);
-            float t = dist / SLAM_RANGE;
-            ei->stunTimer = SLAM_STUN_MAX + (SLAM_STUN_MIN - SLAM_STUN_MAX) * t;
+            DamageEnemy(i, TUNE(SLAM_DAMAGE), DMG_BLUNT, HIT_AOE);
+            float t = dist / TUNE(SLAM_RANGE);
+            ei->stunTimer = TUNE(SLAM_STUN_MAX)
+                + (TUNE(SLAM_STUN_MIN) - TUNE(SLAM_STUN_MAX)) * t;
             if (dist > 1.0f)
                 ei->vel = Vector2Scale(
-                    Vector2Normalize(toEnemy), SLAM_KNOCKBACK);
+                    Vector2Normalize(toEnemy), TUNE(SLAM_KNOCKBACK));
         }
         // cone particles
         for (int i = 0; i < EXPLOSION_RING_COUNT; i++) {
             float a = p->slam.angle - halfArc
-                + (float)i / (float)EXPLOSION_RING_COUNT * SLAM_ARC;
-            float speed = (float)GetRandomValue(SLAM_PARTICLE_SPEED_MIN,
+                + (float)i / (float)EXPLOSION_RING_COUNT * TUNE(SLAM_ARC);
+            float speed = (float)VfxRandom(SLAM_PARTICLE_SPEED_MIN,
                 SLAM_PARTICLE_SPEED_MAX);
             Vector2 vel = { cosf(a) * speed, sinf(a) * speed };
             Color c = (i % 2 == 0) ? (Color)SLAM_COLOR : WHITE;
@@ -1514,10 +1391,10 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
     // --- Parry (brief deflect window) ---
     if (p->parry.cooldownTimer > 0) p->parry.cooldownTimer -= dt;
 
-    if (IsAbilityPressed(p, ABL_PARRY) && p->parry.cooldownTimer <= 0
+    if (IsAbilityPressed(ABL_PARRY) && p->parry.cooldownTimer <= 0
         && !p->parry.active) {
         p->parry.active = true;
-        p->parry.timer = PARRY_WINDOW;
+        p->parry.timer = TUNE(PARRY_WINDOW);
         p->parry.succeeded = false;
     }
 
@@ -1526,62 +1403,64 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
         if (p->parry.timer <= 0) {
             p->parry.active = false;
             p->parry.cooldownTimer = p->parry.succeeded
-                ? PARRY_SUCCESS_COOLDOWN : PARRY_COOLDOWN;
+                ? TUNE(PARRY_SUCCESS_COOLDOWN) : TUNE(PARRY_COOLDOWN);
         }
     }
 
     // --- Deployable spawns ---
     // Turret — placed at mouse, up to placement distance
     if (p->turretCooldown > 0) p->turretCooldown -= dt;
-    if (IsAbilityPressed(p, ABL_TURRET) && p->turretCooldown <= 0) {
+    if (IsAbilityPressed(ABL_TURRET) && p->turretCooldown <= 0) {
         if (CountActiveDeployables(DEPLOY_TURRET) < TURRET_MAX_ACTIVE) {
             float mouseDist = Vector2Length(toMouse);
-            float placeDist = (mouseDist < TURRET_PLACEMENT_DIST) ? mouseDist : TURRET_PLACEMENT_DIST;
+            float placeDist = (mouseDist < TUNE(TURRET_PLACEMENT_DIST))
+                ? mouseDist : TUNE(TURRET_PLACEMENT_DIST);
             Vector2 placePos = (mouseDist > 1.0f)
                 ? Vector2Add(p->pos, Vector2Scale(toMouse, placeDist / mouseDist))
                 : p->pos;
             SpawnDeployable(DEPLOY_TURRET, placePos);
-            p->turretCooldown = TURRET_COOLDOWN;
+            p->turretCooldown = TUNE(TURRET_COOLDOWN);
         }
     }
     // Mine
-    TrySpawnDeployable(p, ABL_MINE, DEPLOY_MINE,
-        &p->mineCooldown, MINE_COOLDOWN, MINE_MAX_ACTIVE, p->pos, dt);
+    TrySpawnDeployable(ABL_MINE, DEPLOY_MINE,
+        &p->mineCooldown, TUNE(MINE_COOLDOWN), MINE_MAX_ACTIVE, p->pos, dt);
     // Heal
-    TrySpawnDeployable(p, ABL_HEAL, DEPLOY_HEAL,
-        &p->healCooldown, HEAL_COOLDOWN, HEAL_MAX_ACTIVE, p->pos, dt);
+    TrySpawnDeployable(ABL_HEAL, DEPLOY_HEAL,
+        &p->healCooldown, TUNE(HEAL_COOLDOWN), HEAL_MAX_ACTIVE, p->pos, dt);
 
     // --- Flamethrower ---
-    bool wantFlame = IsAbilityDown(p, ABL_FIRE) && p->flame.fuel > 0;
+    bool wantFlame = IsAbilityDown(ABL_FIRE) && p->flame.fuel > 0;
     if (wantFlame) {
         p->flame.active = true;
-        p->flame.fuel -= FLAME_DRAIN_RATE * dt;
+        p->flame.fuel -= TUNE(FLAME_DRAIN_RATE) * dt;
         if (p->flame.fuel < 0) p->flame.fuel = 0;
-        p->flame.regenDelay = FLAME_REGEN_DELAY;
+        p->flame.regenDelay = TUNE(FLAME_REGEN_DELAY);
 
         // spray patches at interval
         p->flame.sprayTimer -= dt;
         if (p->flame.sprayTimer <= 0) {
-            p->flame.sprayTimer = FLAME_SPRAY_INTERVAL;
+            p->flame.sprayTimer = TUNE(FLAME_SPRAY_INTERVAL);
             float baseAngle = p->angle;
             float mouseDist = Vector2Length(toMouse);
-            float dist = mouseDist < FLAME_RANGE ? mouseDist : FLAME_RANGE;
+            float dist = mouseDist < TUNE(FLAME_RANGE) ? mouseDist : TUNE(FLAME_RANGE);
             Vector2 target = Vector2Add(p->pos,
                 (Vector2){ cosf(baseAngle) * dist, sinf(baseAngle) * dist });
-            Vector2 jitter = { (float)GetRandomValue(-FLAME_JITTER, FLAME_JITTER),
-                               (float)GetRandomValue(-FLAME_JITTER, FLAME_JITTER) };
+            Vector2 jitter = { (float)SimRandom(-FLAME_JITTER, FLAME_JITTER),
+                               (float)SimRandom(-FLAME_JITTER, FLAME_JITTER) };
             Vector2 patchPos = Vector2Add(target, jitter);
             SpawnDeployable(DEPLOY_FIRE, patchPos);
 
             // spray particles along the path
             for (int i = 0; i < 3; i++) {
-                float pa = baseAngle + ((float)GetRandomValue(-1000, 1000) / 1000.0f) * FLAME_SPREAD;
-                float pd = (float)GetRandomValue(200, 600) / 10.0f;
+                float pa = baseAngle
+                    + ((float)VfxRandom(-1000, 1000) / 1000.0f) * TUNE(FLAME_SPREAD);
+                float pd = (float)VfxRandom(200, 600) / 10.0f;
                 Vector2 ppos = Vector2Add(p->pos,
                     (Vector2){ cosf(pa) * pd, sinf(pa) * pd });
                 Vector2 pvel = { cosf(pa) * FLAME_PARTICLE_SPEED,
                                  sinf(pa) * FLAME_PARTICLE_SPEED };
-                Color c = (GetRandomValue(0, 1) == 0) ? ORANGE : YELLOW;
+                Color c = (VfxRandom(0, 1) == 0) ? ORANGE : YELLOW;
                 SpawnParticle(ppos, pvel, c, FLAME_PARTICLE_SIZE,
                     FLAME_PARTICLE_LIFETIME);
             }
@@ -1591,10 +1470,10 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
         // regen fuel after delay
         if (p->flame.regenDelay > 0) {
             p->flame.regenDelay -= dt;
-        } else if (p->flame.fuel < FLAME_FUEL_MAX) {
-            p->flame.fuel += FLAME_REGEN_RATE * dt;
-            if (p->flame.fuel > FLAME_FUEL_MAX)
-                p->flame.fuel = FLAME_FUEL_MAX;
+        } else if (p->flame.fuel < TUNE(FLAME_FUEL_MAX)) {
+            p->flame.fuel += TUNE(FLAME_REGEN_RATE) * dt;
+            if (p->flame.fuel > TUNE(FLAME_FUEL_MAX))
+                p->flame.fuel = TUNE(FLAME_FUEL_MAX);
         }
     }
 
@@ -1605,22 +1484,11 @@ static void UpdateAbilities(Player *p, Vector2 toMouse, float dt)
 static void UpdatePlayer(float dt)
 {
     Player *p = &g.player;
-    Vector2 toMouse = UpdateMouseAim();
+    Vector2 toMouse = UpdateAim();
 
     // Compute move direction (shared by movement + dash)
-    Vector2 moveDir = { 0, 0 };
-    if (IsKeyDown(KEY_W)) moveDir.y -= 1;
-    if (IsKeyDown(KEY_S)) moveDir.y += 1;
-    if (IsKeyDown(KEY_A)) moveDir.x -= 1;
-    if (IsKeyDown(KEY_D)) moveDir.x += 1;
-    if (IsGamepadAvailable(GAMEPAD_INDEX)) {
-        float lx = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_X);
-        float ly = GetGamepadAxisMovement(GAMEPAD_INDEX, GAMEPAD_AXIS_LEFT_Y);
-        if (fabsf(lx) > GAMEPAD_STICK_DEADZONE) moveDir.x += lx;
-        if (fabsf(ly) > GAMEPAD_STICK_DEADZONE) moveDir.y += ly;
-    }
+    Vector2 moveDir = input->move;
     float moveLen = Vector2Length(moveDir);
-    if (moveLen > 1.0f) moveDir = Vector2Scale(moveDir, 1.0f / moveLen);
 
     UpdateMovement(p, moveDir, moveLen, dt);
     UpdateDash(p, moveDir, moveLen, dt);
@@ -1638,9 +1506,9 @@ static void UpdatePlayer(float dt)
         p->turretCooldown = 0;
         p->mineCooldown = 0;
         p->healCooldown = 0;
-        p->flame.fuel = FLAME_FUEL_MAX;
-        p->dash.charges = p->dash.maxCharges;
-        p->bfg.charge = BFG_CHARGE_COST;
+        p->flame.fuel = TUNE(FLAME_FUEL_MAX);
+        p->dash.charges = TUNE(DASH_MAX_CHARGES);
+        p->bfg.charge = TUNE(BFG_CHARGE_COST);
     }
 
     // Boundary clamp (base + corridor + combat zone)
@@ -1659,7 +1527,7 @@ static void UpdatePlayer(float dt)
 // enemy AI
 static void UpdateEnemies(float dt) {
     Player *p = &g.player;
-    
+
     // --- Pod spawning via phases ---
     bool inBase = (p->pos.x < MAP_LEFT && p->pos.y > STEP_Y) || (p->pos.y > MAP_SIZE);
     if (inBase) {
@@ -1669,11 +1537,11 @@ static void UpdateEnemies(float dt) {
     }
     if (g.phase == PHASE_COMBAT && !inBase && g.spawnDelay <= 0) {
         bool anyAlive = false;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             if (g.enemies[i].active) { anyAlive = true; break; }
         }
         if (!anyAlive) {
-            if (g.enemiesKilled >= BOSS_KILL_THRESHOLD) {
+            if (g.enemiesKilled >= TUNE(BOSS_KILL_THRESHOLD)) {
                 g.phase = PHASE_BOSS;
                 SpawnBoss(CIRC);
             } else {
@@ -1685,13 +1553,15 @@ static void UpdateEnemies(float dt) {
     }
     if (g.phase == PHASE_BOSS) {
         bool bossAlive = false;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
             if (g.enemies[i].active) { bossAlive = true; break; }
         }
         if (!bossAlive) g.phase = PHASE_COMBAT;
     }
 
-    for (int i = 0; i < MAX_ENEMIES; i++) {
+    UpdateFlowField(p->shadowPos);
+
+    for (int i = 0; i < g.pool[POOL_ENEMY].count; i++) {
         Enemy *e = &g.enemies[i];
         if (!e->active) continue;
 
@@ -1703,28 +1573,26 @@ static void UpdateEnemies(float dt) {
         bool rooted = e->rootTimer > 0 || e->stunTimer > 0;
 
         // Clear aggro if target deployable is gone
-        if (e->aggroIdx >= 0) {
-            Deployable *ad = &g.deployables[e->aggroIdx];
-            if (!ad->active || ad->type != DEPLOY_TURRET)
-                e->aggroIdx = -1;
-        }
+        Deployable *aggro = GetDeployable(e->aggro);
+        if (aggro && aggro->type != DEPLOY_TURRET) aggro = NULL;
+        if (!aggro) e->aggro = HANDLE_NONE;
 
-        // Chase target: turret if aggroed, otherwise player shadow
-        Vector2 target = (e->aggroIdx >= 0)
-            ? g.deployables[e->aggroIdx].pos : p->shadowPos;
-        Vector2 toTarget = Vector2Subtract(target, e->pos);
-        float dist = Vector2Length(toTarget);
         // toPlayer still needed for shooting AI
         Vector2 toPlayer = Vector2Subtract(p->shadowPos, e->pos);
         float distToPlayer = Vector2Length(toPlayer);
+
+        // Chase target: turret if aggroed, otherwise player shadow
+        Vector2 target = aggro ? aggro->pos : p->shadowPos;
+        Vector2 toTarget = Vector2Subtract(target, e->pos);
+        float dist = Vector2Length(toTarget);
         // Charge movement — committed direction, no lerp
         if (e->type == TRAP && e->chargeTimer > 0) {
             e->chargeTimer -= dt;
-            e->vel = Vector2Scale(e->chargeDir, TRAP_CHARGE_SPEED);
+            e->vel = Vector2Scale(e->chargeDir, TUNE(TRAP_CHARGE_SPEED));
             if (e->chargeTimer <= 0) {
                 float playerDist = Vector2Distance(e->pos, p->pos);
-                if (playerDist <= TRAP_SLAM_RADIUS) {
-                    DamagePlayer(TRAP_SLAM_DAMAGE, DMG_BLUNT, HIT_AOE);
+                if (playerDist <= TUNE(TRAP_SLAM_RADIUS)) {
+                    DamagePlayer(TUNE(TRAP_SLAM_DAMAGE), DMG_BLUNT, HIT_AOE);
                 }
                 SpawnParticles(e->pos, TRAP_COLOR, 16);
                 SpawnVfxTimer(e->pos, EXPLOSION_VFX_DURATION, VFX_EXPLOSION);
@@ -1738,32 +1606,27 @@ static void UpdateEnemies(float dt) {
                     Vector2 toP = Vector2Subtract(
                         g.player.pos, e->pos);
                     e->sweepAngle = atan2f(toP.y, toP.x);
-                    e->sweepTimer = CIRC_SWORD_DURATION;
+                    e->sweepTimer = TUNE(CIRC_SWORD_DURATION);
                 } else {
                     // Ring burst on arrival
-                    float step = 2.0f * PI / CIRC_RING_COUNT;
-                    for (int b = 0; b < CIRC_RING_COUNT; b++) {
-                        float a = step * b;
-                        Vector2 dir = { cosf(a), sinf(a) };
-                        Vector2 m = Vector2Add(e->pos,
-                            Vector2Scale(dir,
-                                e->size + MUZZLE_OFFSET));
-                        SpawnProjectile(m, dir,
-                            CIRC_RING_SPEED, CIRC_RING_DAMAGE,
-                            CIRC_RING_LIFETIME, CIRC_RING_SIZE,
-                            true, false, PROJ_BULLET,
-                            DMG_BALLISTIC);
-                    }
+                    EmitPattern(PAT_CIRC_RING, e->pos, (Vector2){ 1, 0 },
+                        e->size + MUZZLE_OFFSET);
                     SpawnParticles(e->pos, CIRC_COLOR, 12);
                     SpawnVfxTimer(e->pos, EXPLOSION_VFX_DURATION,
                         VFX_EXPLOSION);
                 }
             }
         } else if (!rooted && dist > 1.0f) {
-            Vector2 chaseDir = Vector2Scale(toTarget, 1.0f / dist);
+            // chasers share the flow field toward the shadow, bosses and
+            // turret aggro steer straight at their own target
+            Vector2 chaseDir;
+            bool direct = aggro || e->type == TRAP || e->type == CIRC
+                || dist < FLOW_DIRECT_DIST;
+            if (direct || !FlowDirection(e->pos, &chaseDir))
+                chaseDir = Vector2Scale(toTarget, 1.0f / dist);
             Vector2 desired;
-            if (e->type == HEXA && e->aggroIdx < 0) {
-                float strafeDir = (i % 2 == 0) ? 1.0f : -1.0f;
+            if (e->type == HEXA && !aggro) {
+                float strafeDir = (float)e->strafeSign;
                 Vector2 perp = { -chaseDir.y * strafeDir,
                                   chaseDir.x * strafeDir };
                 float radial = (dist - HEXA_ORBIT_DIST) / HEXA_ORBIT_DIST;
@@ -1781,7 +1644,8 @@ static void UpdateEnemies(float dt) {
             // apply slow debuff
             if (e->slowTimer > 0)
                 desired = Vector2Scale(desired, e->slowFactor);
-            e->vel = Vector2Lerp(e->vel, desired, ENEMY_VEL_LERP_RATE * dt);
+            e->vel = Vector2Lerp(e->vel, desired,
+                TUNE(ENEMY_VEL_LERP_RATE) * dt);
         } else if (rooted) {
             e->vel = (Vector2){ 0, 0 };
         }
@@ -1794,12 +1658,12 @@ static void UpdateEnemies(float dt) {
         bool stunned = e->stunTimer > 0;
 
         // Shoot target: turret if aggroed, otherwise player
-        Vector2 toShoot = (e->aggroIdx >= 0) ? toTarget : toPlayer;
-        float distToShoot = (e->aggroIdx >= 0) ? dist : distToPlayer;
+        Vector2 toShoot = aggro ? toTarget : toPlayer;
+        float distToShoot = aggro ? dist : distToPlayer;
 
-        // Shoot dispatch
+        // queued, every type fires in its own pass after the loop
         if (!stunned && ENEMY_DEFS[e->type].shoot)
-            ENEMY_DEFS[e->type].shoot(e, toShoot, distToShoot, dt);
+            QueueEnemyShot(i, toShoot, distToShoot, dt);
 
         // Hit flash decay
         if (e->hitFlash > 0) e->hitFlash -= dt;
@@ -1810,46 +1674,48 @@ static void UpdateEnemies(float dt) {
         if (contact && p->iFrames <= 0) {
             // Parry stuns enemy and prevents damage
             if (p->parry.active) {
-                e->stunTimer = PARRY_STUN_DURATION;
+                e->stunTimer = TUNE(PARRY_STUN_DURATION);
                 p->parry.succeeded = true;
                 SpawnParticles(e->pos, WHITE, 8);
                 if (distToPlayer > 1.0f) {
                     Vector2 kb = Vector2Scale(
                         Vector2Normalize(Vector2Subtract(e->pos, p->pos)),
-                        PARRY_KNOCKBACK);
+                        TUNE(PARRY_KNOCKBACK));
                     e->vel = kb;
                 }
             } else {
                 DamagePlayer(e->contactDamage, DMG_BLUNT, HIT_MELEE);
                 // Knockback enemy
                 if (distToPlayer > 1.0f) {
-                    Vector2 kb = Vector2Scale(Vector2Normalize(Vector2Subtract(e->pos, p->pos)), ENEMY_CONTACT_KNOCKBACK);
+                    Vector2 kb = Vector2Scale(Vector2Normalize(Vector2Subtract(e->pos, p->pos)),
+                        TUNE(ENEMY_CONTACT_KNOCKBACK));
                     e->vel = kb;
                 }
             }
         }
 
         // Collide with aggroed turret
-        if (e->aggroIdx >= 0) {
-            Deployable *ad = &g.deployables[e->aggroIdx];
+        Deployable *ad = GetDeployable(e->aggro);
+        if (ad) {
             float turretDist = Vector2Distance(e->pos, ad->pos);
-            if (turretDist < e->size + 10.0f) {
+            if (turretDist < e->size + TUNE(TURRET_HIT_RADIUS)) {
                 ad->hp -= e->contactDamage;
                 if (ad->hp <= 0) {
                     ad->active = false;
                     SpawnParticles(ad->pos, (Color)TURRET_COLOR, 12);
-                    e->aggroIdx = -1;
+                    e->aggro = HANDLE_NONE;
                 }
                 // Knockback enemy off turret
                 if (turretDist > 1.0f) {
                     Vector2 kb = Vector2Scale(
                         Vector2Normalize(Vector2Subtract(e->pos, ad->pos)),
-                        ENEMY_CONTACT_KNOCKBACK);
+                        TUNE(ENEMY_CONTACT_KNOCKBACK));
                     e->vel = kb;
                 }
             }
         }
     }
+    FireEnemyShots();
 }
 
 static void BfgFizzle(Vector2 pos) {
@@ -1861,7 +1727,7 @@ static void SpawnExplosionVfx(Vector2 pos, Color c1, Color c2, Color c3, Color f
     // explosion ring — fast outward burst
     for (int i = 0; i < EXPLOSION_RING_COUNT; i++) {
         float a = (float)i / (float)EXPLOSION_RING_COUNT * 2.0f * PI;
-        float speed = (float)GetRandomValue(
+        float speed = (float)VfxRandom(
             EXPLOSION_RING_SPEED_MIN, EXPLOSION_RING_SPEED_MAX);
         Vector2 vel = { cosf(a) * speed, sinf(a) * speed };
         Color c = (i % 3 == 0) ? c1 : (i % 3 == 1) ? c2 : c3;
@@ -1870,8 +1736,8 @@ static void SpawnExplosionVfx(Vector2 pos, Color c1, Color c2, Color c3, Color f
     }
     // inner fireball — slower, bigger
     for (int i = 0; i < EXPLOSION_FIRE_COUNT; i++) {
-        float a = (float)GetRandomValue(0, 360) * DEG2RAD;
-        float speed = (float)GetRandomValue(
+        float a = (float)VfxRandom(0, 360) * DEG2RAD;
+        float speed = (float)VfxRandom(
             EXPLOSION_FIRE_SPEED_MIN, EXPLOSION_FIRE_SPEED_MAX);
         Vector2 vel = { cosf(a) * speed, sinf(a) * speed };
         SpawnParticle(pos, vel, fireColor, EXPLOSION_FIRE_SIZE,
@@ -1879,8 +1745,8 @@ static void SpawnExplosionVfx(Vector2 pos, Color c1, Color c2, Color c3, Color f
     }
     // smoke — slow drift outward
     for (int i = 0; i < EXPLOSION_SMOKE_COUNT; i++) {
-        float a = (float)GetRandomValue(0, 360) * DEG2RAD;
-        float speed = (float)GetRandomValue(
+        float a = (float)VfxRandom(0, 360) * DEG2RAD;
+        float speed = (float)VfxRandom(
             EXPLOSION_SMOKE_SPEED_MIN, EXPLOSION_SMOKE_SPEED_MAX);
         Vector2 vel = { cosf(a) * speed, sinf(a) * speed };
         SpawnParticle(pos, vel, GRAY, EXPLOSION_SMOKE_SIZE,
@@ -1893,7 +1759,10 @@ static void SpawnExplosionVfx(Vector2 pos, Color c1, Color c2, Color c3, Color f
 static void AoeDamage(Vector2 pos, float radius, int damage,
     float knockback, DamageType dmgType)
 {
-    for (int j = 0; j < MAX_ENEMIES; j++) {
+    static int cand[MAX_ENEMIES];
+    int n = QueryEnemies(pos, radius, cand, MAX_ENEMIES);
+    for (int c = 0; c < n; c++) {
+        int j = cand[c];
         if (!g.enemies[j].active) continue;
         Enemy *ej = &g.enemies[j];
         float dist = Vector2Distance(pos, ej->pos);
@@ -1908,19 +1777,19 @@ static void AoeDamage(Vector2 pos, float radius, int damage,
 
 static void RocketExplode(Vector2 pos) {
     Player *p = &g.player;
-    AoeDamage(pos, ROCKET_EXPLOSION_RADIUS, ROCKET_EXPLOSION_DAMAGE,
-        ROCKET_KNOCKBACK, DMG_EXPLOSIVE);
+    AoeDamage(pos, TUNE(ROCKET_EXPLOSION_RADIUS), TUNE(ROCKET_EXPLOSION_DAMAGE),
+        TUNE(ROCKET_KNOCKBACK), DMG_EXPLOSIVE);
 
     // rocket jump — push player away from explosion
     float playerDist = Vector2Distance(pos, p->pos);
-    if (playerDist < ROCKET_EXPLOSION_RADIUS) {
-        float scale = 1.0f - (playerDist / ROCKET_EXPLOSION_RADIUS);
+    if (playerDist < TUNE(ROCKET_EXPLOSION_RADIUS)) {
+        float scale = 1.0f - (playerDist / TUNE(ROCKET_EXPLOSION_RADIUS));
         Vector2 away = Vector2Subtract(p->pos, pos);
         if (Vector2Length(away) > 1.0f) {
             p->vel = Vector2Scale(
-                Vector2Normalize(away), ROCKET_JUMP_FORCE * scale);
+                Vector2Normalize(away), TUNE(ROCKET_JUMP_FORCE) * scale);
         }
-        p->hp -= ROCKET_JUMP_DAMAGE;
+        p->hp -= TUNE(ROCKET_JUMP_DAMAGE);
         SpawnParticles(p->pos, RED, CONTACT_HIT_PARTICLES);
         if (p->hp <= 0) { p->hp = 0; g.gameOver = true; }
     }
@@ -1928,48 +1797,46 @@ static void RocketExplode(Vector2 pos) {
 }
 
 static void GrenadeExplode(Vector2 pos) {
-    AoeDamage(pos, GRENADE_EXPLOSION_RADIUS, GRENADE_EXPLOSION_DAMAGE,
-        GRENADE_KNOCKBACK, DMG_EXPLOSIVE);
+    AoeDamage(pos, TUNE(GRENADE_EXPLOSION_RADIUS), TUNE(GRENADE_EXPLOSION_DAMAGE),
+        TUNE(GRENADE_KNOCKBACK), DMG_EXPLOSIVE);
     SpawnExplosionVfx(pos, GREEN, YELLOW, ORANGE, YELLOW);
 }
 
 // deployables ------------------------------------------------------------- /
 static void SpawnDeployable(DeployableType type, Vector2 pos) {
-    for (int i = 0; i < MAX_DEPLOYABLES; i++) {
-        if (!g.deployables[i].active) {
-            Deployable *d = &g.deployables[i];
-            d->active = true;
-            d->pos = pos;
-            d->type = type;
-            d->actionTimer = 0;
-            d->hp = 0;
-            switch (type) {
-                case DEPLOY_TURRET:
-                    d->timer = TURRET_LIFETIME;
-                    d->radius = TURRET_RANGE;
-                    d->hp = TURRET_HP;
-                    break;
-                case DEPLOY_MINE:
-                    d->timer = MINE_LIFETIME;
-                    d->radius = MINE_TRIGGER_RADIUS;
-                    break;
-                case DEPLOY_HEAL:
-                    d->timer = HEAL_LIFETIME;
-                    d->radius = HEAL_RADIUS;
-                    break;
-                case DEPLOY_FIRE:
-                    d->timer = FLAME_PATCH_LIFETIME;
-                    d->radius = FLAME_PATCH_RADIUS;
-                    break;
-            }
+    int i = ClaimSlot(POOL_DEPLOYABLE);
+    if (i < 0) return;
+    Deployable *d = &g.deployables[i];
+    d->active = true;
+    d->gen = NEXT_GEN(d->gen);
+    d->pos = pos;
+    d->type = type;
+    d->actionTimer = 0;
+    d->hp = 0;
+    switch (type) {
+        case DEPLOY_TURRET:
+            d->timer = TUNE(TURRET_LIFETIME);
+            d->radius = TUNE(TURRET_RANGE);
+            d->hp = TUNE(TURRET_HP);
+            break;
+        case DEPLOY_MINE:
+            d->timer = TUNE(MINE_LIFETIME);
+            d->radius = TUNE(MINE_TRIGGER_RADIUS);
+            break;
+        case DEPLOY_HEAL:
+            d->timer = TUNE(HEAL_LIFETIME);
+            d->radius = TUNE(HEAL_RADIUS);
+            break;
+        case DEPLOY_FIRE:
+            d->timer = TUNE(FLAME_PATCH_LIFETIME);
+            d->radius = TUNE(FLAME_PATCH_RADIUS);
             break;
-        }
     }
 }
 
 static void UpdateDeployables(float dt) {
     Player *p = &g.player;
-    for (int i = 0; i < MAX_DEPLOYABLES; i++) {
+    for (int i = 0; i < g.pool[POOL_DEPLOYABLE].count; i++) {
         Deployable *d = &g.deployables[i];
         if (!d->active) continue;
 
@@ -1986,7 +1853,7 @@ static void UpdateDeployables(float dt) {
                 // find nearest enemy in range
                 int best = -1;
                 float bestDist = d->radius;
-                for (int j = 0; j < MAX_ENEMIES; j++) {
+                for (int j = 0; j < g.pool[POOL_ENEMY].count; j++) {
                     if (!g.enemies[j].active) continue;
                     float dist = Vector2Distance(d->pos, g.enemies[j].pos);
                     if (dist < bestDist) {
@@ -2000,15 +1867,15 @@ static void UpdateDeployables(float dt) {
                     Vector2 muzzle = Vector2Add(d->pos,
                         Vector2Scale(dir, TURRET_MUZZLE_OFFSET));
                     SpawnProjectile(muzzle, dir,
-                        TURRET_BULLET_SPEED, TURRET_DAMAGE,
-                        TURRET_BULLET_LIFETIME, TURRET_BULLET_SIZE,
+                        TUNE(TURRET_BULLET_SPEED), TUNE(TURRET_DAMAGE),
+                        TUNE(TURRET_BULLET_LIFETIME), TUNE(TURRET_BULLET_SIZE),
                         false, false, PROJ_BULLET, DMG_BALLISTIC);
                     SpawnParticle(muzzle,
                         Vector2Scale(dir, TURRET_MUZZLE_SPEED),
                         (Color)TURRET_COLOR, TURRET_MUZZLE_SIZE,
                         TURRET_MUZZLE_LIFETIME);
-                    g.enemies[best].aggroIdx = (i8)i;
-                    d->actionTimer = TURRET_FIRE_RATE;
+                    g.enemies[best].aggro = DeployableHandle(i);
+                    d->actionTimer = TUNE(TURRET_FIRE_RATE);
                 }
             }
         } break;
@@ -2016,7 +1883,7 @@ static void UpdateDeployables(float dt) {
         case DEPLOY_MINE: {
             // mine trigger check: proximity to any enemy
             bool triggered = false;
-            for (int j = 0; j < MAX_ENEMIES; j++) {
+            for (int j = 0; j < g.pool[POOL_ENEMY].count; j++) {
                 Enemy *e = &g.enemies[j];
                 if (!e->active) continue;
                 if (Vector2Distance(d->pos, e->pos) < d->radius + e->size) {
@@ -2026,11 +1893,11 @@ static void UpdateDeployables(float dt) {
             }
             if (triggered) {
                 // root all enemies in AOE (no move, can still shoot)
-                for (int j = 0; j < MAX_ENEMIES; j++) {
+                for (int j = 0; j < g.pool[POOL_ENEMY].count; j++) {
                     Enemy *e = &g.enemies[j];
                     if (!e->active) continue;
-                    if (Vector2Distance(d->pos, e->pos) < MINE_ROOT_RADIUS)
-                        e->rootTimer = MINE_ROOT_DURATION;
+                    if (Vector2Distance(d->pos, e->pos) < TUNE(MINE_ROOT_RADIUS))
+                        e->rootTimer = TUNE(MINE_ROOT_DURATION);
                 }
                 d->active = false;
                 SpawnParticles(d->pos, (Color)MINE_COLOR, 10);
@@ -2041,17 +1908,17 @@ static void UpdateDeployables(float dt) {
 
         case DEPLOY_HEAL: {
             float dist = Vector2Distance(d->pos, p->pos);
-            if (dist < d->radius && p->hp < p->maxHp) {
-                p->hp += HEAL_PER_SEC * dt;
-                if (p->hp > p->maxHp) p->hp = p->maxHp;
+            if (dist < d->radius && p->hp < TUNE(PLAYER_HP)) {
+                p->hp += TUNE(HEAL_PER_SEC) * dt;
+                if (p->hp > TUNE(PLAYER_HP)) p->hp = TUNE(PLAYER_HP);
             }
             // heal turrets in range
-            for (int j = 0; j < MAX_DEPLOYABLES; j++) {
+            for (int j = 0; j < g.pool[POOL_DEPLOYABLE].count; j++) {
                 Deployable *t = &g.deployables[j];
                 if (!t->active || t->type != DEPLOY_TURRET) continue;
-                if (Vector2Distance(d->pos, t->pos) < d->radius && t->hp < TURRET_HP) {
-                    t->hp += HEAL_PER_SEC * dt;
-                    if (t->hp > TURRET_HP) t->hp = TURRET_HP;
+                if (Vector2Distance(d->pos, t->pos) < d->radius && t->hp < TUNE(TURRET_HP)) {
+                    t->hp += TUNE(HEAL_PER_SEC) * dt;
+                    if (t->hp > TUNE(TURRET_HP)) t->hp = TUNE(TURRET_HP);
                 }
             }
         } break;
@@ -2059,13 +1926,13 @@ static void UpdateDeployables(float dt) {
         case DEPLOY_FIRE: {
             d->actionTimer -= dt;
             if (d->actionTimer <= 0) {
-                d->actionTimer = FLAME_PATCH_TICK;
-                for (int j = 0; j < MAX_ENEMIES; j++) {
+                d->actionTimer = TUNE(FLAME_PATCH_TICK);
+                for (int j = 0; j < g.pool[POOL_ENEMY].count; j++) {
                     Enemy *e = &g.enemies[j];
                     if (!e->active) continue;
                     if (Vector2Distance(d->pos, e->pos) < d->radius + e->size) {
                         DamageEnemy(j,
-                            (int)(FLAME_PATCH_DPS * FLAME_PATCH_TICK),
+                            (int)(TUNE(FLAME_PATCH_DPS) * TUNE(FLAME_PATCH_TICK)),
                             DMG_ABILITY, HIT_AOE);
                     }
                 }
@@ -2099,11 +1966,11 @@ static void TriggerLightningChain(Vector2 origin, int firstEnemyIdx) {
     memset(lc, 0, sizeof(*lc));
     lc->active = true;
     lc->propagating = true;
-    lc->hopTimer = BFG_HOP_DELAY;
+    lc->hopTimer = TUNE(BFG_HOP_DELAY);
     lc->currentWave = 0;
 
     // first enemy is wave 0 — already damaged by direct hit
-    lc->hit[firstEnemyIdx] = true;
+    lc->hitGen[firstEnemyIdx] = g.enemies[firstEnemyIdx].gen;
     lc->sources[0] = origin;
     lc->sourceCount = 1;
 }
@@ -2129,22 +1996,26 @@ static void UpdateLightningChain(float dt) {
     if (lc->propagating) {
         lc->hopTimer -= dt;
         if (lc->hopTimer <= 0) {
-            lc->hopTimer = BFG_HOP_DELAY;
+            lc->hopTimer = TUNE(BFG_HOP_DELAY);
             lc->nextSourceCount = 0;
 
             // for each source in current wave, find nearby unhit enemies
+            static int cand[MAX_ENEMIES];
             for (int s = 0; s < lc->sourceCount; s++) {
                 Vector2 src = lc->sources[s];
-                for (int j = 0; j < MAX_ENEMIES; j++) {
+                int n = QueryEnemies(src, TUNE(BFG_CHAIN_RADIUS), cand, MAX_ENEMIES);
+                for (int c = 0; c < n; c++) {
+                    int j = cand[c];
                     if (!g.enemies[j].active) continue;
-                    if (lc->hit[j]) continue;
+                    // a recycled slot has a new gen and counts as unhit
+                    if (lc->hitGen[j] == g.enemies[j].gen) continue;
 
                     float dist = Vector2Distance(src, g.enemies[j].pos);
-                    if (dist <= BFG_CHAIN_RADIUS + g.enemies[j].size) {
-                        lc->hit[j] = true;
+                    if (dist <= TUNE(BFG_CHAIN_RADIUS) + g.enemies[j].size) {
+                        lc->hitGen[j] = g.enemies[j].gen;
 
                         // damage enemy
-                        DamageEnemy(j, BFG_CHAIN_DAMAGE, DMG_ABILITY, HIT_AOE);
+                        DamageEnemy(j, TUNE(BFG_CHAIN_DAMAGE), DMG_ABILITY, HIT_AOE);
 
                         // spark particles on hit
                         SpawnParticles(g.enemies[j].pos, (Color)BFG_COLOR, BFG_HIT_PARTICLES);
@@ -2154,11 +2025,10 @@ static void UpdateLightningChain(float dt) {
                             LightningArc *a = &lc->arcs[lc->arcCount++];
                             a->from = src;
                             a->to = g.enemies[j].pos;
-                            a->timer = BFG_ARC_DURATION;
-                            a->duration = BFG_ARC_DURATION;
+                            a->timer = TUNE(BFG_ARC_DURATION);
+                            a->duration = TUNE(BFG_ARC_DURATION);
                             a->active = true;
                             a->damageApplied = true;
-                            a->targetIdx = j;
                         }
 
                         // add as source for next wave
@@ -2188,196 +2058,304 @@ static void UpdateLightningChain(float dt) {
     }
 }
 
-static void UpdateProjectiles(float dt) {
-    Player *p = &g.player;
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        Projectile *b = &g.projectiles[i];
-        if (!b->active) continue;
-
-        // grenade: drag + visual bounce arc
-        if (b->type == PROJ_GRENADE) {
-            b->vel = Vector2Scale(b->vel, 1.0f - GRENADE_DRAG * dt);
-            // visual height simulation
-            b->heightVel -= GRENADE_ARC_GRAVITY * dt;
-            b->height += b->heightVel * dt;
-            if (b->height <= 0.0f) {
-                b->height = 0.0f;
-                b->heightVel = -b->heightVel * GRENADE_ARC_BOUNCE_DAMPING;
-                if (b->heightVel < GRENADE_ARC_MIN_VEL) b->heightVel = 0.0f;
-            }
-        }
-
-        // bfg: spawn trail particles
-        if (b->type == PROJ_BFG && !b->isEnemy) {
-            Vector2 tvel = { (float)GetRandomValue(-40, 40),
-                             (float)GetRandomValue(-40, 40) };
-            Color tc = GetRandomValue(0, 1) ? (Color)BFG_COLOR : WHITE;
-            SpawnParticle(b->pos, tvel, tc, BFG_TRAIL_SIZE, BFG_TRAIL_LIFETIME);
-        }
-
-        b->pos = Vector2Add(b->pos, Vector2Scale(b->vel, dt));
-        b->lifetime -= dt;
-
-        // fuse timer expired
-        if (b->lifetime <= 0) {
+// movement, fuses and map edge, shared by both shot pools
+// returns false once the shot is gone
+static bool MoveProjectile(Projectile *b, float dt) {
+    // grenade: drag + visual bounce arc
+    if (b->type == PROJ_GRENADE) {
+        b->vel = Vector2Scale(b->vel, 1.0f - TUNE(GRENADE_DRAG) * dt);
+        // visual height simulation
+        b->heightVel -= TUNE(GRENADE_ARC_GRAVITY) * dt;
+        b->height += b->heightVel * dt;
+        if (b->height <= 0.0f) {
+            b->height = 0.0f;
+            b->heightVel = -b->heightVel * TUNE(GRENADE_ARC_BOUNCE_DAMPING);
+            if (b->heightVel < TUNE(GRENADE_ARC_MIN_VEL)) b->heightVel = 0.0f;
+        }
+    }
+
+    // bfg: spawn trail particles
+    if (b->type == PROJ_BFG) {
+        Vector2 tvel = { (float)VfxRandom(-40, 40),
+                         (float)VfxRandom(-40, 40) };
+        Color tc = VfxRandom(0, 1) ? (Color)BFG_COLOR : WHITE;
+        SpawnParticle(b->pos, tvel, tc, BFG_TRAIL_SIZE, BFG_TRAIL_LIFETIME);
+    }
+
+    b->pos = Vector2Add(b->pos, Vector2Scale(b->vel, dt));
+    b->lifetime -= dt;
+
+    // fuse timer expired
+    if (b->lifetime <= 0) {
+        if (b->type == PROJ_ROCKET) RocketExplode(b->pos);
+        if (b->type == PROJ_GRENADE) GrenadeExplode(b->pos);
+        if (b->type == PROJ_BFG) BfgFizzle(b->pos);
+        b->active = false;
+        return false;
+    }
+
+    // map boundary
+    if (b->pos.x < 0 || b->pos.x > MAP_RIGHT ||
+        b->pos.y < 0 || b->pos.y > BASE_BOTTOM) {
+        if (b->type == PROJ_GRENADE && b->bounces > 0) {
+            // bounce off map edges
+            if (b->pos.x < 0)          { b->pos.x = 0;          b->vel.x = -b->vel.x; }
+            if (b->pos.x > MAP_RIGHT)  { b->pos.x = MAP_RIGHT;  b->vel.x = -b->vel.x; }
+            if (b->pos.y < 0)          { b->pos.y = 0;          b->vel.y = -b->vel.y; }
+            if (b->pos.y > BASE_BOTTOM){ b->pos.y = BASE_BOTTOM; b->vel.y = -b->vel.y; }
+            b->vel = Vector2Scale(b->vel, TUNE(GRENADE_BOUNCE_DAMPING));
+            b->bounces--;
+        } else {
             if (b->type == PROJ_ROCKET) RocketExplode(b->pos);
             if (b->type == PROJ_GRENADE) GrenadeExplode(b->pos);
             if (b->type == PROJ_BFG) BfgFizzle(b->pos);
             b->active = false;
-            continue;
+            return false;
         }
+    }
+    return true;
+}
+
+// enemy shots: shield, turrets, player. never touch enemies
+// live shots are gathered into flat arrays and every overlap is tested in
+// straight-line float loops the compiler can vectorize (no trig, no early
+// outs). only shots that touched something go through the scalar resolve,
+// in slot order, so shield breaks and iframes still apply shot by shot
+enum { SHOT_HIT_PLAYER = 1, SHOT_HIT_SHIELD = 2 };
+
+static struct {
+    int idx[MAX_ENEMY_SHOTS];       // slot in g.enemyShots
+    float x[MAX_ENEMY_SHOTS];
+    float y[MAX_ENEMY_SHOTS];
+    float r[MAX_ENEMY_SHOTS];
+    u8 mask[MAX_ENEMY_SHOTS];       // SHOT_HIT_* bits
+    int turret[MAX_ENEMY_SHOTS];    // first turret overlapped, -1 = none
+    int hits[MAX_ENEMY_SHOTS];      // shots with anything to resolve
+    float tx[MAX_DEPLOYABLES];
+    float ty[MAX_DEPLOYABLES];
+    int tidx[MAX_DEPLOYABLES];      // slot in g.deployables
+} shotPass;
+
+// first live turret the shot overlaps, for when the batched answer died
+// earlier in the resolve
+static int ShotTurret(const Projectile *b) {
+    for (int j = 0; j < g.pool[POOL_DEPLOYABLE].count; j++) {
+        Deployable *d = &g.deployables[j];
+        if (!d->active || d->type != DEPLOY_TURRET) continue;
+        if (Vector2Distance(b->pos, d->pos) < TUNE(TURRET_HIT_RADIUS) + b->size)
+            return j;
+    }
+    return -1;
+}
+
+static void UpdateEnemyShots(float dt) {
+    Player *p = &g.player;
 
-        // map boundary
-        if (b->pos.x < 0 || b->pos.x > MAP_RIGHT ||
-            b->pos.y < 0 || b->pos.y > BASE_BOTTOM) {
-            if (b->type == PROJ_GRENADE && b->bounces > 0) {
-                // bounce off map edges
-                if (b->pos.x < 0)          { b->pos.x = 0;          b->vel.x = -b->vel.x; }
-                if (b->pos.x > MAP_RIGHT)  { b->pos.x = MAP_RIGHT;  b->vel.x = -b->vel.x; }
-                if (b->pos.y < 0)          { b->pos.y = 0;          b->vel.y = -b->vel.y; }
-                if (b->pos.y > BASE_BOTTOM){ b->pos.y = BASE_BOTTOM; b->vel.y = -b->vel.y; }
-                b->vel = Vector2Scale(b->vel, GRENADE_BOUNCE_DAMPING);
-                b->bounces--;
+    // move + gather
+    int n = 0;
+    for (int i = 0; i < g.pool[POOL_ENEMY_SHOT].count; i++) {
+        Projectile *b = &g.enemyShots[i];
+        if (!b->active) continue;
+        if (!MoveProjectile(b, dt)) continue;
+        shotPass.idx[n] = i;
+        shotPass.x[n] = b->pos.x;
+        shotPass.y[n] = b->pos.y;
+        shotPass.r[n] = b->size;
+        n++;
+    }
+    int nt = 0;
+    for (int j = 0; j < g.pool[POOL_DEPLOYABLE].count; j++) {
+        Deployable *d = &g.deployables[j];
+        if (!d->active || d->type != DEPLOY_TURRET) continue;
+        shotPass.tx[nt] = d->pos.x;
+        shotPass.ty[nt] = d->pos.y;
+        shotPass.tidx[nt] = j;
+        nt++;
+    }
+
+    // player + shield in one pass, the shield is InArc unrolled into flat
+    // math so the loop stays branch-free
+    float px = p->pos.x, py = p->pos.y, ps = p->size;
+    int shieldOn = p->shield.active && p->shield.hp > 0;
+    ArcSector sa = MakeArc(p->pos, p->shield.angle, TUNE(SHIELD_ARC) / 2.0f,
+        TUNE(SHIELD_RADIUS));
+    float fx = sa.facing.x, fy = sa.facing.y, cosHalf = sa.cosHalf;
+    for (int k = 0; k < n; k++) {
+        float dx = shotPass.x[k] - px;
+        float dy = shotPass.y[k] - py;
+        float d2 = dx * dx + dy * dy;
+        float pr = ps + shotPass.r[k];
+        float sr = TUNE(SHIELD_RADIUS) + shotPass.r[k];
+        float dot = dx * fx + dy * fy;
+        int player = d2 < pr * pr;
+        int shield = shieldOn & (d2 < sr * sr)
+            & (dot >= cosHalf * sqrtf(d2));
+        shotPass.mask[k] = (u8)(player * SHOT_HIT_PLAYER
+            | shield * SHOT_HIT_SHIELD);
+        shotPass.turret[k] = -1;
+    }
+    // turrets, walked backwards so the lowest slot wins like a forward scan
+    for (int t = nt - 1; t >= 0; t--) {
+        float tx = shotPass.tx[t], ty = shotPass.ty[t];
+        for (int k = 0; k < n; k++) {
+            float dx = shotPass.x[k] - tx;
+            float dy = shotPass.y[k] - ty;
+            float tr = TUNE(TURRET_HIT_RADIUS) + shotPass.r[k];
+            int hit = dx * dx + dy * dy < tr * tr;
+            shotPass.turret[k] = hit ? t : shotPass.turret[k];
+        }
+    }
+    int nh = 0;
+    for (int k = 0; k < n; k++) {
+        shotPass.hits[nh] = k;
+        nh += (shotPass.mask[k] != 0) | (shotPass.turret[k] >= 0);
+    }
+
+    // scalar resolve
+    for (int h = 0; h < nh; h++) {
+        int k = shotPass.hits[h];
+        Projectile *b = &g.enemyShots[shotPass.idx[k]];
+        u8 m = shotPass.mask[k];
+
+        // Shield absorbs enemy projectiles, may have broken earlier on
+        if ((m & SHOT_HIT_SHIELD) && p->shield.active && p->shield.hp > 0) {
+            p->shield.hp -= (float)b->damage;
+            // Shield break
+            if (p->shield.hp <= 0) {
+                p->shield.hp = 0;
+                p->shield.active = false;
+                p->shield.regenTimer = -TUNE(SHIELD_BROKEN_COOLDOWN);
+                SpawnParticles(p->pos, (Color)SHIELD_COLOR, 12);
             } else {
-                if (b->type == PROJ_ROCKET) RocketExplode(b->pos);
-                if (b->type == PROJ_GRENADE) GrenadeExplode(b->pos);
-                if (b->type == PROJ_BFG) BfgFizzle(b->pos);
+                // Absorb spark
+                SpawnParticle(b->pos, (Vector2){ 0, 0 },
+                    (Color)SHIELD_COLOR, 3.0f, 0.15f);
+            }
+            b->active = false;
+            continue;
+        }
+        // Enemy projectile — hit turrets
+        if (shotPass.turret[k] >= 0) {
+            int j = shotPass.tidx[shotPass.turret[k]];
+            if (!g.deployables[j].active) j = ShotTurret(b);
+            if (j >= 0) {
+                Deployable *d = &g.deployables[j];
+                d->hp -= b->damage;
+                SpawnParticle(b->pos, (Vector2){ 0, 0 },
+                    (Color)TURRET_COLOR, 2.0f, 0.1f);
+                if (d->hp <= 0) {
+                    d->active = false;
+                    SpawnParticles(d->pos, (Color)TURRET_COLOR, 12);
+                }
                 b->active = false;
                 continue;
             }
         }
+        // Enemy projectile — hit player
+        if ((m & SHOT_HIT_PLAYER) && p->iFrames <= 0) {
+            DamagePlayer(b->damage, b->dmgType, HIT_PROJ);
+            if (!g.invincible) b->active = false;
+        }
+    }
+}
 
-
-        if (b->isEnemy) {
-            // Shield absorbs enemy projectiles
-            if (p->shield.active && p->shield.hp > 0) {
-                float dist = Vector2Distance(b->pos, p->pos);
-                if (dist < SHIELD_RADIUS + b->size) {
-                    // Check if projectile is within shield arc
-                    Vector2 toProj = Vector2Subtract(b->pos, p->pos);
-                    float projAngle = atan2f(toProj.y, toProj.x);
-                    float diff = fmodf(projAngle - p->shield.angle + 3*PI, 2*PI) - PI;
-                    if (fabsf(diff) <= SHIELD_ARC / 2.0f) {
-                        p->shield.hp -= (float)b->damage;
-                        // Shield break
-                        if (p->shield.hp <= 0) {
-                            p->shield.hp = 0;
-                            p->shield.active = false;
-                            p->shield.regenTimer = -SHIELD_BROKEN_COOLDOWN;
-                            SpawnParticles(p->pos, (Color)SHIELD_COLOR, 12);
-                        } else {
-                            // Absorb spark
-                            SpawnParticle(b->pos, (Vector2){ 0, 0 },
-                                (Color)SHIELD_COLOR, 3.0f, 0.15f);
-                        }
-                        b->active = false;
-                        continue;
-                    }
-                }
-            }
-            // Enemy projectile — hit turrets
-            bool hitTurret = false;
-            for (int j = 0; j < MAX_DEPLOYABLES; j++) {
-                Deployable *d = &g.deployables[j];
-                if (!d->active || d->type != DEPLOY_TURRET) continue;
-                float td = Vector2Distance(b->pos, d->pos);
-                if (td < 10.0f + b->size) {
-                    d->hp -= b->damage;
-                    SpawnParticle(b->pos, (Vector2){ 0, 0 },
-                        (Color)TURRET_COLOR, 2.0f, 0.1f);
-                    if (d->hp <= 0) {
-                        d->active = false;
-                        SpawnParticles(d->pos, (Color)TURRET_COLOR, 12);
+// player shots: enemies only, through the grid
+static void UpdatePlayerShots(float dt) {
+    static int cand[MAX_ENEMIES];
+    for (int i = 0; i < g.pool[POOL_PLAYER_SHOT].count; i++) {
+        Projectile *b = &g.playerShots[i];
+        if (!b->active) continue;
+        if (!MoveProjectile(b, dt)) continue;
+
+        // Player projectile — hit enemies, grid candidates only
+        int n = QueryEnemies(b->pos, b->size, cand, MAX_ENEMIES);
+        for (int c = 0; c < n; c++) {
+            int j = cand[c];
+            if (!g.enemies[j].active) continue;
+            Enemy *ej = &g.enemies[j];
+            bool hit = EnemyHitPoint(ej, b->pos, b->size);
+            if (hit) {
+                DamageEnemy(j, b->damage, b->dmgType, HIT_PROJ);
+                // sniper slow debuff (super shot gets enhanced slow)
+                if (b->appliesSlow) {
+                    if (b->damage >= TUNE(SNIPER_SUPER_DAMAGE)) {
+                        ej->slowTimer = TUNE(SNIPER_SUPER_SLOW_DUR);
+                        ej->slowFactor = TUNE(SNIPER_SUPER_SLOW_FACTOR);
+                    } else {
+                        ej->slowTimer = TUNE(SNIPER_SLOW_DURATION);
+                        ej->slowFactor = TUNE(SNIPER_SLOW_FACTOR);
                     }
-                    b->active = false;
-                    hitTurret = true;
-                    break;
                 }
-            }
-            if (hitTurret) continue;
-            // Enemy projectile — hit player
-            float dist = Vector2Distance(b->pos, p->pos);
-            if (dist < p->size + b->size && p->iFrames <= 0) {
-                DamagePlayer(b->damage, b->dmgType, HIT_PROJ);
-                if (!g.invincible) b->active = false;
-            }
-        } else {
-            // Player projectile — hit enemies
-            for (int j = 0; j < MAX_ENEMIES; j++) {
-                if (!g.enemies[j].active) continue;
-                Enemy *ej = &g.enemies[j];
-                bool hit = EnemyHitPoint(ej, b->pos, b->size);
-                if (hit) {
-                    DamageEnemy(j, b->damage, b->dmgType, HIT_PROJ);
-                    // sniper slow debuff (super shot gets enhanced slow)
-                    if (b->appliesSlow) {
-                        if (b->damage >= SNIPER_SUPER_DAMAGE) {
-                            ej->slowTimer = SNIPER_SUPER_SLOW_DUR;
-                            ej->slowFactor = SNIPER_SUPER_SLOW_FACTOR;
-                        } else {
-                            ej->slowTimer = SNIPER_SLOW_DURATION;
-                            ej->slowFactor = SNIPER_SLOW_FACTOR;
-                        }
-                    }
-                    if (b->type == PROJ_ROCKET) {
-                        RocketExplode(b->pos);
-                    } else if (b->type == PROJ_GRENADE) {
-                        GrenadeExplode(b->pos);
-                    } else if (b->type == PROJ_BFG) {
-                        TriggerLightningChain(ej->pos, j);
-                        // detonation burst
-                        SpawnParticles(ej->pos, (Color)BFG_COLOR, BFG_DETONATION_PARTICLES);
-                        SpawnParticles(ej->pos, WHITE, BFG_DETONATION_PARTICLES / 2);
-                    } else if (b->knockback) {
-                        Vector2 kb = Vector2Normalize(b->vel);
-                        ej->vel = Vector2Scale(kb, SHOTGUN_KNOCKBACK);
-                        // ricochet to nearest enemy
-                        if (b->bounces > 0) {
-                            b->bounces--;
-                            b->lifetime = SHOTGUN_BULLET_LIFETIME;
-                            float bestDist = 1e9f;
-                            int bestIdx = -1;
-                            for (int k = 0; k < MAX_ENEMIES; k++) {
-                                if (k == j || !g.enemies[k].active) continue;
-                                float d = Vector2Distance(b->pos, g.enemies[k].pos);
-                                if (d < bestDist) {
-                                    bestDist = d;
-                                    bestIdx = k;
-                                }
-                            }
-                            float speed = Vector2Length(b->vel) * SHOTGUN_BOUNCE_SPEED;
-                            if (bestIdx >= 0) {
-                                Vector2 dir = Vector2Normalize(
-                                    Vector2Subtract(g.enemies[bestIdx].pos, b->pos));
-                                b->vel = Vector2Scale(dir, speed);
-                            } else {
-                                // no target — reflect velocity
-                                b->vel = Vector2Scale(Vector2Normalize(b->vel), -speed);
+                if (b->type == PROJ_ROCKET) {
+                    RocketExplode(b->pos);
+                } else if (b->type == PROJ_GRENADE) {
+                    GrenadeExplode(b->pos);
+                } else if (b->type == PROJ_BFG) {
+                    TriggerLightningChain(ej->pos, j);
+                    // detonation burst
+                    SpawnParticles(ej->pos, (Color)BFG_COLOR, BFG_DETONATION_PARTICLES);
+                    SpawnParticles(ej->pos, WHITE, BFG_DETONATION_PARTICLES / 2);
+                } else if (b->knockback) {
+                    Vector2 kb = Vector2Normalize(b->vel);
+                    ej->vel = Vector2Scale(kb, TUNE(SHOTGUN_KNOCKBACK));
+                    // ricochet to nearest enemy
+                    if (b->bounces > 0) {
+                        b->bounces--;
+                        b->lifetime = TUNE(SHOTGUN_BULLET_LIFETIME);
+                        float bestDist = 1e9f;
+                        int bestIdx = -1;
+                        for (int k = 0; k < g.pool[POOL_ENEMY].count; k++) {
+                            if (k == j || !g.enemies[k].active) continue;
+                            float d = Vector2Distance(b->pos, g.enemies[k].pos);
+                            if (d < bestDist) {
+                                bestDist = d;
+                                bestIdx = k;
                             }
-                            break;
                         }
+                        float speed = Vector2Length(b->vel) * TUNE(SHOTGUN_BOUNCE_SPEED);
+                        if (bestIdx >= 0) {
+                            Vector2 dir = Vector2Normalize(
+                                Vector2Subtract(g.enemies[bestIdx].pos, b->pos));
+                            b->vel = Vector2Scale(dir, speed);
+                        } else {
+                            // no target — reflect velocity
+                            b->vel = Vector2Scale(Vector2Normalize(b->vel), -speed);
+                        }
+                        break;
                     }
-                    b->active = false;
-                    break;
                 }
+                b->active = false;
+                break;
             }
         }
     }
 }
 
+static void UpdateProjectiles(float dt) {
+    UpdatePlayerShots(dt);
+    UpdateEnemyShots(dt);
+}
+
 // one pool of particles belonging, spawned wherever
+// dead slots get integrated too, no branch per particle so each field loop
+// vectorizes. their velocity is zeroed instead of dragged, decaying forever
+// would walk it into denormals and those are slow
 static void UpdateParticles(float dt) 
 {
-    // --- Particles ---
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        Particle *pt = &g.vfx.particles[i];
-        if (!pt->active) continue;
-        pt->pos = Vector2Add(pt->pos, Vector2Scale(pt->vel, dt));
-        pt->vel = Vector2Scale(pt->vel, 1.0f - PARTICLE_DRAG * dt);
-        pt->lifetime -= dt;
-        if (pt->lifetime <= 0) pt->active = false;
+    ParticleStore *ps = &g.vfx.particles;
+    int n = g.pool[POOL_PARTICLE].count;
+    float drag = 1.0f - PARTICLE_DRAG * dt;
+    for (int i = 0; i < n; i++) {
+        float k = ps->active[i] ? drag : 0.0f;
+        ps->pos[i].x += ps->vel[i].x * dt;
+        ps->pos[i].y += ps->vel[i].y * dt;
+        ps->vel[i].x *= k;
+        ps->vel[i].y *= k;
+    }
+    for (int i = 0; i < n; i++) {
+        ps->lifetime[i] -= dt;
+        ps->active[i] = ps->active[i] & (ps->lifetime[i] > 0);
     }
-
 }
 
 static void UpdateBeams(float dt)
@@ -2423,29 +2401,26 @@ static void MoveCamera(float dt)
     // so its like how much the camera lags behind the player?
     // should be normed between 0 and 1 or capped?
     // game feel thing for sure
-    g.camera.target = Vector2Lerp(g.camera.target, p->pos, CAMERA_LERP_RATE * dt);
-
-    g.camera.offset = 
-        (Vector2){ GetScreenWidth() / 2.0f, GetScreenHeight() / 2.0f };
+    g.camera.target = Vector2Lerp(g.camera.target, p->pos, TUNE(CAMERA_LERP_RATE) * dt);
+    // the offset is the window's, UpdateGame sets it
 }
 
 
-// ok so game state. giant function.
-// let's separate this and make it more modular
-// so its not so hard to add features. 
-// or is it commonplace to have massive functions in the game dev world?
-void UpdateGame(void)
+// one sim tick: the input frame in, g one tick further on. nothing in
+// here (or under it) touches raylib's input, clock, rng or window, the
+// host does all that in UpdateGame, so the same frames fed to the same
+// state always give the same ticks. pause is the host's too, it just
+// doesn't call this
+void Step(const InputFrame *in)
 {
-    WindowResize();
-    DetectInputMode();
-
-    // frametime clamp
-    float dt = GetFrameTime();
-    if (dt > DT_MAX) dt = DT_MAX;
+    input = in;
+    float dt = in->dt;
+    g.time += dt;
 
     if (g.phase == PHASE_SELECT) {
         UpdateSelect(dt);
         // Shared systems still run during select (projectiles from weapon demos, etc.)
+        BuildEnemyGrid();
         UpdateProjectiles(dt);
         UpdateParticles(dt);
         for (int i = 0; i < MAX_VFX_TIMERS; i++) {
@@ -2454,46 +2429,32 @@ void UpdateGame(void)
             if (g.vfx.timers[i].timer <= 0)
                 g.vfx.timers[i].active = false;
         }
+        CompactPools();
         MoveCamera(dt);
         return;
     }
 
-    // need to make sure that esc also pauses in native build
-    if (IsKeyPressed(KEY_P) || IsKeyPressed(KEY_ESCAPE)
-        || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_MIDDLE_RIGHT))
-        g.paused = !g.paused;
-
-    if (g.paused && IsKeyPressed(KEY_F)) {
-        int mon = GetCurrentMonitor();
-        ToggleFullscreen();
-        if (!IsWindowFullscreen()) {
-            int mx = GetMonitorWidth(mon);
-            int my = GetMonitorHeight(mon);
-            Vector2 pos = GetMonitorPosition(mon);
-            SetWindowSize(SCREEN_W, SCREEN_H);
-            SetWindowPosition(pos.x + (float)(mx - SCREEN_W) / 2,
-                              pos.y + (float)(my - SCREEN_H) / 2);
-        }
-    }
-
     if (g.gameOver) {
-        if (IsKeyPressed(KEY_ENTER)
-            || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_RIGHT_FACE_DOWN))
-            InitGame();
+        if (ConfirmPressed()) InitGame();
         return;
     }
 
-    if (g.paused) return;
-
     // Tick transition fade-in (second half, after screen switch)
     if (g.transitionTimer > 0) {
         g.transitionTimer -= dt;
         if (g.transitionTimer <= 0) g.transitionTimer = 0;
     }
 
+    // broadphase for this tick, every few ticks the enemy array itself is
+    // re-sorted into grid order first so cell walks hit contiguous slots
+    if (g.tick++ % ENEMY_SORT_INTERVAL == 0) SortEnemiesSpatial();
+    else BuildEnemyGrid();
+
     UpdateShop();
     UpdatePlayer(dt);
     UpdateEnemies(dt);
+    BuildEnemyGrid();   // enemies moved and pods spawned
+    SeparateEnemies();
     UpdateProjectiles(dt);
     UpdateLightningChain(dt);
     UpdateParticles(dt);
@@ -2507,5 +2468,61 @@ void UpdateGame(void)
             g.vfx.timers[i].active = false;
     }
 
+    CompactPools();
     MoveCamera(dt);
 }
+
+// the host half now: window, debug keys, pause, then sample the input and
+// hand it to Step
+void UpdateGame(void)
+{
+    WindowResize();
+    DetectInputMode();
+
+    if (IsKeyPressed(KEY_F3)) g.showStats = !g.showStats;
+#ifndef PLATFORM_WEB
+    if (IsKeyPressed(KEY_F5)) SaveSnapshot();
+    if (IsKeyPressed(KEY_F9)) RestoreLatestSnapshot();
+#endif
+
+    // the governor wants the raw frame time, ReadInput clamps it for Step
+    float frameTime = GetFrameTime();
+    GovernParticles(frameTime);
+
+    if (g.phase != PHASE_SELECT) {
+        // need to make sure that esc also pauses in native build
+        if (IsKeyPressed(KEY_P) || IsKeyPressed(KEY_ESCAPE)
+            || IsGamepadButtonPressed(GAMEPAD_INDEX, GAMEPAD_BUTTON_MIDDLE_RIGHT))
+            g.paused = !g.paused;
+
+        if (g.paused && IsKeyPressed(KEY_F)) {
+            int mon = GetCurrentMonitor();
+            ToggleFullscreen();
+            if (!IsWindowFullscreen()) {
+                int mx = GetMonitorWidth(mon);
+                int my = GetMonitorHeight(mon);
+                Vector2 pos = GetMonitorPosition(mon);
+                SetWindowSize(SCREEN_W, SCREEN_H);
+                SetWindowPosition(pos.x + (float)(mx - SCREEN_W) / 2,
+                                  pos.y + (float)(my - SCREEN_H) / 2);
+            }
+        }
+    }
+
+    // game over still takes the restart while paused
+    bool combat = g.phase != PHASE_SELECT && !g.gameOver && !g.paused;
+    if (g.phase == PHASE_SELECT || g.gameOver || !g.paused) {
+        InputFrame in;
+        ReadInput(&in, frameTime);
+        double t0 = GetTime();
+        Step(&in);
+        // smoothed cost for the F3 overlay
+        float ms = (float)((GetTime() - t0) * 1000.0);
+        g.stepMs += (ms - g.stepMs) * STEP_TIME_SMOOTH;
+    }
+
+    g.camera.offset =
+        (Vector2){ GetScreenWidth() / 2.0f, GetScreenHeight() / 2.0f };
+    // what a replay or the wire would pay for this tick, F3 shows it
+    if (combat && g.showStats) MeasureSnapshotDelta();
+}
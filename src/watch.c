@@ -0,0 +1,195 @@
+// watch.c
+// asset hot reload for the native dev build (linux, ASSET_HOT_RELOAD)
+// inotify on the asset folder, a saved file is read back in, patched over
+// its blob entry and every texture registered for it is swapped in place.
+// the blob on disk isn't touched, ./build2.sh blob once you're happy
+#include "game.h"
+#include "blob.h"
+
+#if defined(ASSET_HOT_RELOAD) && defined(__linux__)
+#include <dirent.h>
+#include <stdio.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define WATCH_EVENTS    (IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE)
+
+static struct {
+    int fd;
+    char root[WATCH_PATH_MAX];
+    int dirCount;
+    struct {
+        int wd;
+        char rel[WATCH_PATH_MAX];   // "" for the root, "inner" etc
+    } dirs[WATCH_MAX_DIRS];
+    int texCount;
+    struct {
+        u32 id;
+        Texture2D *tex;
+    } textures[WATCH_MAX_TEXTURES];
+} watch = { .fd = -1 };
+
+static void JoinPath(char *out, const char *a, const char *b)
+{
+    if (!*a) snprintf(out, WATCH_PATH_MAX, "%s", b);
+    else snprintf(out, WATCH_PATH_MAX, "%s/%s", a, b);
+}
+
+// inotify isn't recursive, every folder under the root gets its own watch
+static void AddWatchDir(const char *rel)
+{
+    if (watch.dirCount >= WATCH_MAX_DIRS) {
+        TraceLog(LOG_WARNING, "WATCH: more than %d folders, %s not watched",
+            WATCH_MAX_DIRS, rel);
+        return;
+    }
+    char path[WATCH_PATH_MAX];
+    JoinPath(path, watch.root, rel);
+    int wd = inotify_add_watch(watch.fd, path, WATCH_EVENTS);
+    if (wd < 0) return;
+    watch.dirs[watch.dirCount].wd = wd;
+    snprintf(watch.dirs[watch.dirCount].rel, WATCH_PATH_MAX, "%s", rel);
+    watch.dirCount++;
+
+    DIR *dir = opendir(path);
+    if (!dir) return;
+    struct dirent *de;
+    while ((de = readdir(dir)) != NULL) {
+        if (de->d_name[0] == '.') continue;
+        char sub[WATCH_PATH_MAX], full[WATCH_PATH_MAX];
+        JoinPath(sub, rel, de->d_name);
+        JoinPath(full, watch.root, sub);
+        struct stat st;
+        if (stat(full, &st) == 0 && S_ISDIR(st.st_mode)) AddWatchDir(sub);
+    }
+    closedir(dir);
+}
+
+static const char *DirForWatch(int wd)
+{
+    for (int i = 0; i < watch.dirCount; i++)
+        if (watch.dirs[i].wd == wd) return watch.dirs[i].rel;
+    return NULL;
+}
+
+void InitAssetWatch(const char *dir)
+{
+    watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watch.fd < 0) {
+        TraceLog(LOG_WARNING, "WATCH: inotify unavailable, no hot reload");
+        return;
+    }
+    snprintf(watch.root, WATCH_PATH_MAX, "%s", dir);
+    AddWatchDir("");
+    if (!watch.dirCount) {
+        TraceLog(LOG_INFO, "WATCH: no folder at %s, no hot reload", dir);
+        CloseAssetWatch();
+        return;
+    }
+    TraceLog(LOG_INFO, "WATCH: hot reloading %s (%d folders)",
+        dir, watch.dirCount);
+}
+
+void CloseAssetWatch(void)
+{
+    if (watch.fd >= 0) close(watch.fd);
+    watch.fd = -1;
+    watch.dirCount = 0;
+}
+
+// the slot is overwritten when its asset changes, so whoever holds the
+// pointer draws the new one next frame without knowing anything happened
+void WatchAssetTexture(u32 id, Texture2D *tex)
+{
+    if (watch.texCount >= WATCH_MAX_TEXTURES) return;
+    watch.textures[watch.texCount].id = id;
+    watch.textures[watch.texCount].tex = tex;
+    watch.texCount++;
+}
+
+// latency is reported twice: from the write (file mtime against the wall
+// clock, what it feels like at the desk) and from the poll that noticed it
+// to the swap (read + decode + upload, what it costs the frame)
+static void ReloadAsset(const char *name, double seen)
+{
+    int idx = FindAsset(name);
+    if (idx < 0) {
+        TraceLog(LOG_INFO, "WATCH: %s isn't in the blob, repack to add it",
+            name);
+        return;
+    }
+    char path[WATCH_PATH_MAX];
+    JoinPath(path, watch.root, name);
+    struct stat st;
+    int len = 0;
+    u8 *data = LoadFileData(path, &len);
+    if (!data || stat(path, &st) != 0) {
+        UnloadFileData(data);
+        return;
+    }
+    PatchAsset(idx, data, len);
+
+    u32 id = BlobHashName(name);
+    int swapped = 0;
+    for (int i = 0; i < watch.texCount; i++) {
+        if (watch.textures[i].id != id) continue;
+        Texture2D fresh = LoadAssetTexture(id);
+        if (!fresh.id) continue;
+        UnloadTexture(*watch.textures[i].tex);
+        *watch.textures[i].tex = fresh;
+        swapped++;
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    double sinceWrite = (double)(now.tv_sec - st.st_mtim.tv_sec) * 1000.0
+        + (double)(now.tv_nsec - st.st_mtim.tv_nsec) / 1e6;
+    TraceLog(LOG_INFO, "WATCH: %s reloaded, %d textures swapped, "
+        "%.1f ms after the write, %.2f ms to swap",
+        name, swapped, sinceWrite, (GetTime() - seen) * 1000.0);
+}
+
+// once a frame, before the update. drains every pending event, then reloads
+// each changed file once, an editor save is often several events
+void PollAssetWatch(void)
+{
+    if (watch.fd < 0) return;
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char changed[WATCH_MAX_BATCH][WATCH_PATH_MAX];
+    int changedCount = 0;
+    double seen = GetTime();
+    ssize_t n;
+    while ((n = read(watch.fd, buf, sizeof(buf))) > 0) {
+        const struct inotify_event *ev;
+        for (char *p = buf; p < buf + n; p += sizeof(*ev) + ev->len) {
+            ev = (const struct inotify_event *)p;
+            const char *dir = DirForWatch(ev->wd);
+            if (!ev->len || !dir || ev->name[0] == '.') continue;
+            char rel[WATCH_PATH_MAX];
+            JoinPath(rel, dir, ev->name);
+            if (ev->mask & IN_ISDIR) {
+                if (ev->mask & IN_CREATE) AddWatchDir(rel);
+                continue;
+            }
+            if (!(ev->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))) continue;
+            bool dup = false;
+            for (int i = 0; i < changedCount && !dup; i++)
+                dup = strcmp(changed[i], rel) == 0;
+            if (!dup && changedCount < WATCH_MAX_BATCH)
+                memcpy(changed[changedCount++], rel, WATCH_PATH_MAX);
+        }
+    }
+    for (int i = 0; i < changedCount; i++) ReloadAsset(changed[i], seen);
+}
+
+#else
+
+// release and web builds, nothing to watch
+void InitAssetWatch(const char *dir) { (void)dir; }
+void CloseAssetWatch(void) {}
+void WatchAssetTexture(u32 id, Texture2D *tex) { (void)id; (void)tex; }
+void PollAssetWatch(void) {}
+
+#endif